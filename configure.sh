@@ -6,7 +6,8 @@
 ##   configure script to copy appropriate Makefile.$osname                     ##
 ##                                                                             ##
 ##   Usage: configure.sh [-h] [-v] [-l] [-prefix dir] [-debug] [-check]        ##
-##                       [-with_timing] [-nompi] [-noerror]                    ##
+##                       [-with_timing] [-openmp] [-pthread] [-zlib] [-nompi]  ##
+##                       [-noerror]                                            ##
 ##                       [-Dmacro[=value] ...]                                 ##
 ##                                                                             ##
 ## (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file ##
@@ -16,12 +17,15 @@
 ## Contact: https://github.com/PIK-LPJmL/LPJmL                                 ##
 #################################################################################
 
-USAGE="Usage: $0 [-h] [-v] [-l] [-prefix dir] [-debug] [-with_timing] [-nompi] [-check] [-check_balance] [-noerror] [-Dmacro[=value] ...]"
+USAGE="Usage: $0 [-h] [-v] [-l] [-prefix dir] [-debug] [-with_timing] [-openmp] [-pthread] [-zlib] [-nompi] [-check] [-check_balance] [-noerror] [-Dmacro[=value] ...]"
 ERR_USAGE="\nTry \"$0 --help\" for more information."
 debug=0
 nompi=0
 prefix=$PWD
 checking=""
+openmp=""
+pthread=""
+zlib=""
 macro=""
 warning="-Werror"
 while(( "$#" )); do
@@ -38,6 +42,9 @@ while(( "$#" )); do
       echo "-prefix dir     set installation directory for LPJmL. Default is current directory"
       echo "-debug          set debug flags and disable optimization"
       echo "-with_timing    enable timing functions for performance analysis"
+      echo "-openmp         enable OpenMP parallelization of the cell loops"
+      echo "-pthread        enable asynchronous writing of output in a separate thread"
+      echo "-zlib           enable compression of restart files, zlib library is required"
       echo "-check          enable run-time checking of memory leaks and access out of bounds"
       echo "-check_balance  enable balance checking in lpj functions"
       echo "-noerror        do not stop compilation on warnings"
@@ -89,6 +96,21 @@ while(( "$#" )); do
       macro="$macro -DUSE_TIMING"
       shift 1
       ;;
+    -openmp)
+      macro="$macro -DUSE_OPENMP"
+      openmp="\$(OMPFLAGS)"
+      shift 1
+      ;;
+    -pthread)
+      macro="$macro -DUSE_PTHREAD"
+      pthread="-pthread"
+      shift 1
+      ;;
+    -zlib)
+      macro="$macro -DUSE_ZLIB"
+      zlib="-lz"
+      shift 1
+      ;;
     -check_balance)
       macro="$macro -DCHECK_BALANCE"
       shift 1
@@ -182,11 +204,15 @@ else
 fi
 if [ "$debug" = "1" ]
 then
-  echo "CFLAGS	= \$(WFLAG) \$(LPJFLAGS) $macro $warning $checking \$(DEBUGFLAGS)" >>Makefile.inc
-  echo "LNOPTS	= \$(WFLAG) \$(DEBUGFLAGS) $checking -o " >>Makefile.inc
+  echo "CFLAGS	= \$(WFLAG) \$(LPJFLAGS) $macro $warning $checking $openmp $pthread \$(DEBUGFLAGS)" >>Makefile.inc
+  echo "LNOPTS	= \$(WFLAG) \$(DEBUGFLAGS) $checking $openmp $pthread -o " >>Makefile.inc
 else
-  echo "CFLAGS	= \$(WFLAG) \$(LPJFLAGS) $macro $warning $checking \$(OPTFLAGS)" >>Makefile.inc
-  echo "LNOPTS	= \$(WFLAG) \$(OPTFLAGS) $checking -o " >>Makefile.inc
+  echo "CFLAGS	= \$(WFLAG) \$(LPJFLAGS) $macro $warning $checking $openmp $pthread \$(OPTFLAGS)" >>Makefile.inc
+  echo "LNOPTS	= \$(WFLAG) \$(OPTFLAGS) $checking $openmp $pthread -o " >>Makefile.inc
+fi
+if [ "$zlib" != "" ]
+then
+  echo "LIBS	+= $zlib" >>Makefile.inc
 fi
 echo "GIT_REPO=" $(git remote -v|head -1|cut  -f2|cut -d' ' -f1) >>Makefile.inc
 echo LPJROOT	= $prefix >>Makefile.inc
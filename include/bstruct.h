@@ -24,7 +24,7 @@ typedef enum {BSTRUCT_BYTE,BSTRUCT_SHORT,BSTRUCT_INT,BSTRUCT_FLOAT,BSTRUCT_DOUBL
               BSTRUCT_FALSE,BSTRUCT_TRUE,BSTRUCT_USHORT,BSTRUCT_ZERO,BSTRUCT_FZERO,
               BSTRUCT_NULL,BSTRUCT_STRING,BSTRUCT_STRING1,BSTRUCT_BEGINARRAY,BSTRUCT_BEGINARRAY1,
               BSTRUCT_BEGINSTRUCT, BSTRUCT_INDEXARRAY,BSTRUCT_ENDSTRUCT,BSTRUCT_ENDARRAY,
-              BSTRUCT_END} Bstruct_token;
+              BSTRUCT_END,BSTRUCT_ZSTRUCT} Bstruct_token;
 
 typedef struct
 {
@@ -52,6 +52,9 @@ extern char *bstruct_typenames[];
 
 extern Bstruct bstruct_open(const char *,Bool);
 extern Bstruct bstruct_wopen(const char *,Bool,Bool);
+extern Bstruct bstruct_memopen(Bool);
+extern Bool bstruct_mmap(Bstruct);
+extern const char *bstruct_getbuffer(Bstruct,size_t *);
 extern int bstruct_getmiss(const Bstruct);
 extern int bstruct_getnoread(const Bstruct);
 extern FILE *bstruct_getfile(Bstruct);
@@ -80,6 +83,9 @@ extern Bool bstruct_writestring(Bstruct,const char *,const char *);
 extern Bool bstruct_writebeginarray(Bstruct,const char *,int);
 extern Bool bstruct_writebeginindexarray(Bstruct,const char *,long long *,int);
 extern Bool bstruct_writebeginstruct(Bstruct,const char *);
+extern Bool bstruct_writebeginzstruct(Bstruct);
+extern Bool bstruct_writeendzstruct(Bstruct);
+extern Bool bstruct_setcompress(Bstruct,int);
 extern Bool bstruct_writeendstruct(Bstruct);
 extern Bool bstruct_writeendarray(Bstruct);
 extern void bstruct_fprintdata(FILE *,const Bstruct_data *,int);
@@ -88,6 +94,7 @@ extern void bstruct_freedata(Bstruct_data *);
 extern Bool bstruct_readbeginarray(Bstruct,const char *,int *);
 extern Bool bstruct_readindexarray(Bstruct,long long *,int);
 extern Bool bstruct_seekindexarray(Bstruct,int,int);
+extern Bool bstruct_loadarray(Bstruct,int,long long,long long);
 extern Bool bstruct_readbool(Bstruct,const char *,Bool *);
 extern Bool bstruct_readbyte(Bstruct,const char *,Byte *);
 extern Bool bstruct_readint(Bstruct,const char *,int *);
@@ -115,6 +122,7 @@ extern Bool bstruct_isnull(Bstruct,const char *);
 extern void bstruct_printnoread(Bstruct,Bool);
 extern Bool bstruct_writedata(Bstruct,const Bstruct_data *);
 extern int bstruct_getlevel(const Bstruct);
+extern long long bstruct_getnamepos(const Bstruct);
 
 /* Definition of macros */
 
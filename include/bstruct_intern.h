@@ -32,9 +32,11 @@
 
 #define BSTRUCT_HEADER "BSTRUCT"
 #define BSTRUCT_VERSION 1
-#define BSTRUCT_MAXTOKEN BSTRUCT_END /* valid tokens are in the range of [0,BSTRUCT_MAXTOKEN] */
+#define BSTRUCT_MAXTOKEN BSTRUCT_ZSTRUCT /* valid tokens are in the range of [0,BSTRUCT_MAXTOKEN] */
 #define BSTRUCT_HASHSIZE 1023
 #define MAXLEVEL 15 /**< maximum number of nested structs */
+#define BSTRUCT_BLOCKSIZE 1048576 /* size of data block written at once */
+#define BSTRUCT_NAMECACHE 256 /* size of cache of name ids, must be power of 2 */
 
 extern const size_t bstruct_typesizes[];
 
@@ -42,6 +44,10 @@ extern const size_t bstruct_typesizes[];
 #define isinvalidtoken(token) (((token) & 63)>BSTRUCT_MAXTOKEN)
 #define bstruct_printnamestack(bstr) bstruct_fprintnamestack(stderr,bstr)
 #define bstruct_hasname(token) (((token) & 128)==128) /* check for top bit set in token */
+#define bstruct_getpos(bstr) (((bstr)->mem!=NULL) ? (long long)(bstr)->pos : ftell((bstr)->file)) /* position of next object read */
+#define bstruct_tell(bstr) ((((bstr)->file==NULL) ? 0 : ftell((bstr)->file))+(long long)(bstr)->blocklen) /* position of next object written */
+
+typedef unsigned short Id;
 
 struct bstruct
 {
@@ -62,12 +68,36 @@ struct bstruct
   } namestack[MAXLEVEL]; /**< list of objects names for each nested level */
   Hash hash;             /**< hash for object names used for writing restart files */
   int count;             /**< size of name table */
+  long long namepos;     /**< file position of name table, 0 if unknown */
   Hashitem *names;       /**< name table used for reading restart files */
   Hashitem *names2;      /**< name table sorted by id  */
+  char *buf;             /**< buffer of data read by bstruct_loadarray() or NULL */
+  const char *mem;       /**< restart data in memory read by pointer arithmetic or NULL */
+  size_t memsize;        /**< size of data in memory */
+  size_t pos;            /**< read position in memory */
+  Bool ismapped;         /**< data in memory are mapped from file */
+  int compress;          /**< compression level of structs written by bstruct_writebeginzstruct() */
+  Bool iszstruct;        /**< compressed struct is written or read */
+  size_t zstart;         /**< start of struct to be compressed in block */
+  char *zbuf;            /**< buffer for compressed/uncompressed struct or NULL */
+  size_t zbufsize;       /**< size of buffer */
+  struct
+  {
+    const char *mem;     /**< pointer to data in memory or NULL */
+    size_t memsize;      /**< size of data in memory */
+    size_t pos;          /**< read position in memory */
+  } outer;               /**< read position after compressed struct */
+  char *block;           /**< block of written data not yet flushed to file or NULL */
+  size_t blocklen;       /**< number of bytes in block */
+  size_t blocksize;      /**< allocated size of block */
+  struct
+  {
+    const char *name;    /**< address of name passed by caller */
+    const char *key;     /**< name stored in hash or name table */
+    Id id;               /**< id of name */
+  } namecache[BSTRUCT_NAMECACHE]; /**< ids of names indexed by address of name */
 };                       /**< Definition of opaque datatype Bstruct */
 
-typedef unsigned short Id;
-
 typedef struct
 {
   long long filepos; /**< position of object in file */
@@ -84,5 +114,12 @@ extern Bool bstruct_readtoken(Bstruct,Byte *,Byte,const char *);
 extern Bool bstruct_skipdata(Bstruct,Byte);
 extern Bool bstruct_findobject(Bstruct,Byte *,Byte,const char *);
 extern Bool bstruct_writename(Bstruct bstr,Byte,const char *);
+extern Bool bstruct_write(Bstruct,const void *,size_t);
+extern Bool bstruct_flush(Bstruct);
+extern Bool bstruct_read(Bstruct,void *,size_t);
+extern Bool bstruct_readvalues(Bstruct,void *,size_t,size_t);
+extern Bool bstruct_seek(Bstruct,long long,int);
+extern Bool bstruct_readzstruct(Bstruct);
+extern void bstruct_closezstruct(Bstruct);
 extern Var *bstruct_findvar(Bstruct,Id);
 extern Bool bstruct_readid(Bstruct,Byte,Id *);
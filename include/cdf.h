@@ -62,6 +62,8 @@ typedef struct
   Bool ready;       /**< data was already averaged */
   Bool swap;        /**< byte order has to be changed (TRUE/FALSE) */
   FILE *file;       /**< file pointer */
+  void *map;        /**< memory-mapped file or NULL */
+  size_t mapsize;   /**< size of memory-mapped file in bytes */
   int fmt;          /**< file format (RAW/CLM/CDF) */
   int id;           /**< id for sockets */
   int version;      /**< file version number */
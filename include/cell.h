@@ -167,6 +167,10 @@ Received 19 November 1997; accepted 15 January 1999*/
   Hydrotope hydrotopes;
   Balance balance;          /**< balance checks */
   Seed seed;                /**< seed for random generator */
+  Real cost;                /**< accumulated computing time of cell for domain decomposition (sec) */
+  Stocks spinup_sum;        /**< sum of stocks in current spinup convergence window (gC/m2,gN/m2) */
+  Stocks spinup_mean;       /**< mean stocks of previous spinup convergence window (gC/m2,gN/m2) */
+  Bool isconverged;         /**< stocks have converged during spinup (TRUE/FALSE) */
 #if defined IMAGE && defined COUPLED
   Real npp_nat;             /**< NPP natural stand */
   Real npp_wp;              /**< NPP woodplantation */
@@ -204,6 +208,9 @@ extern Bool iterateyear(Outputfile *,Cell [],Input *,
                         Real,Real *,Real *,int,int,int,const Config *);
 extern void initoutputdata(Output *,int,int,const Config *);
 extern Bool fwriteoutput(Outputfile *,Cell [],int,int,int,int,int,const Config *);
+extern Bool fwritecost(const Cell [],const char *,const Config *);
+extern Bool checkspinup(Cell [],int,const Config *);
+extern void unfreezecells(Cell [],const Config *);
 extern void equilsom(Cell *,int, const Pftpar [],Bool);
 extern void equilveg(Cell *,int);
 extern void check_fluxes(Cell *,int,int,const Config *);
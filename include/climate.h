@@ -65,6 +65,22 @@ typedef struct
   Real *data;       /**< atmospheric CO2 (ppmv) */
 } Tracedata;
 
+typedef struct
+{
+  void *data;   /**< stored data of all years or NULL */
+  Type type;    /**< datatype of stored data (LPJ_SHORT/LPJ_FLOAT/LPJ_DOUBLE) */
+  Real scalar;  /**< scaling factor for short data */
+  int n;        /**< number of values per year */
+} Storedvar;
+
+typedef struct
+{
+  Storedvar temp,prec,wet,wind,tamp,tmax,humid,tmin;
+  Storedvar lwnet,swdown,burntarea,no3deposition,nh4deposition;
+} Climatestore; /**< climate data stored for spin-up */
+
+typedef struct readahead *Readahead;
+
 typedef struct
 {
   int firstyear;    /**< first year of data available for all variables (AD) */
@@ -81,6 +97,7 @@ typedef struct
 #endif
   Climatefile file_burntarea;
   Climatedata data[4]; /**< climate data arrays */
+  Readahead readahead; /**< readahead of climate files for next year or NULL */
 } Climate;
 
 /* Definitions of macros */
@@ -112,11 +129,12 @@ extern Bool getch4(const Climate *,Real *,int,const Config *);
 extern void closeclimateanomalies(Climate *,const Config *);
 extern void closeclimatefiles(Climate *,const Config *);
 extern void freeclimate(Climate *,Bool);
-extern Bool storeclimate(Climatedata *,Climate *,const Cell *,int,int,
+extern Bool storeclimate(Climatestore *,Climate *,const Cell *,int,int,
                          const Config *);
 extern void freeclimatedata(Climatedata *);
-extern void restoreclimate(Climate *,const Climatedata *,int);
-extern void moveclimate(Climate *,const Climatedata *,int,int);
+extern void freeclimatestore(Climatestore *);
+extern void restoreclimate(Climate *,const Climatestore *,int);
+extern void moveclimate(Climate *,const Climatestore *,int,int);
 extern void prdaily(Real [],int,Real,Real,Seed);
 extern void dailyclimate(Dailyclimate *,const Climate *,Climbuf *,
                          int,int,int,int);
@@ -128,6 +146,11 @@ extern Bool openclimate(Climatefile *,const Filename *,const char *,Type,int,Rea
 extern Real avgtemp(const Climate *,int cell);
 extern Real avgprec(const Climate *,int cell);
 extern void closeclimatefile(Climatefile *,Bool);
+extern void mapclimate(Climatefile *,const char *,Bool);
+extern void readaheadclimate(Climate *,int,const Config *);
+extern void waitreadahead(Readahead);
+extern Bool getreadahead(Readahead,const Climatefile *,Real [],int,Bool *);
+extern void freereadahead(Readahead);
 extern Bool readclimate(Climatefile *,Real *,Real,Real,const Cell *,int,int,
                         const Config *);
 extern Bool checkvalidclimate(Climate *,Cell *,Config *);
@@ -86,6 +86,11 @@
 #define NO_FERTILIZER 0
 #define FERTILIZER 1
 #define AUTO_FERTILIZER 2
+#define EQUAL_DECOMPOSITION 0
+#define COST_DECOMPOSITION 1
+#define BASIN_DECOMPOSITION 2
+#define BISECT_SOLVER 0
+#define ILLINOIS_SOLVER 1
 #define NOUT 359
 /* number of output files */
 #define GRIDBASED 1         /* pft-specific outputs scaled by stand->frac */
@@ -181,6 +181,8 @@ struct config
   Real laimax;        /**< maximum LAI for benchmark */
   Bool withdailyoutput; /**< with daily output (TRUE/FALSE) */
   Bool flush_output;   /**< flush output after every simulation year (TRUE/FALSE) */
+  Bool parallel_output; /**< each task writes its output directly into file (TRUE/FALSE) */
+  Bool async_output;    /**< output is written by separate writer thread (TRUE/FALSE) */
   Bool nofill;          /**< do not fill NetCDF files at creation (TRUE/FALSE) */
   Bool isnetcdf4;       /**< output file is in NetCDF4 format (TRUE/FALSE) */
   int fdi;
@@ -209,6 +211,9 @@ struct config
   Bool grassonly;               /**< set all cropland including others to zero but keep managed grasslands */
   Bool luc_timber;              /***< land-use change timber */
   Bool storeclimate;           /**< store climate data in spin-up phase */
+  Type store_climate_type;     /**< datatype of stored climate data (LPJ_DOUBLE/LPJ_FLOAT/LPJ_SHORT) */
+  Bool readahead_climate;      /**< read and convert climate data of next year in advance (TRUE/FALSE) */
+  Bool mmap_climate;           /**< map climate data files into memory (TRUE/FALSE) */
   Bool shuffle_spinup_climate;  /**< shuffle spinup climate */
   Bool fix_climate;             /**< fix climate after specified year */
   int fix_climate_year;         /**< year at which climate is fixed */
@@ -249,7 +254,13 @@ struct config
 #endif
   char *write_restart_filename; /**< filename of restart file */
   char *checkpoint_restart_filename; /**< filename of checkpoint restart file */
+  char *cost_filename;       /**< filename of cell cost file for domain decomposition */
+  char *write_cost_filename; /**< filename of cell cost file written */
+  char *timing_filename;     /**< filename of JSON timing report or NULL */
   Bool ischeckpoint;      /**< run from checkpoint file ? (TRUE/FALSE) */
+  Bool fast_restart;      /**< read restart data of each task in one block into memory (TRUE/FALSE) */
+  Bool mmap_restart;      /**< map restart file into memory (TRUE/FALSE) */
+  int restart_compression; /**< compression level of cells in restart files (0-9) */
   int checkpointyear;     /**< year stored in restart file */
   char **pfttypes;        /**< array for PFT type names of size ntypes */
   Pftpar *pftpar;         /**< PFT parameter array */
@@ -260,6 +271,9 @@ struct config
   int firstgrid; /**< index of first grid cell */
   int nspinup;   /**< number of spinup years */
   int nspinyear; /**< cycle length during spinup (yr) */
+  Bool spinup_convergence; /**< terminate spinup if stocks have converged (TRUE/FALSE) */
+  int spinup_window;       /**< length of window for spinup convergence check (yr) */
+  Real spinup_tolerance;   /**< maximum relative change of stocks between windows for convergence */
   int lastyear;  /**< last simulation year (AD) */
   int firstyear; /**< first simulation year (AD) */
   int outputyear; /**< first year for output (AD) */
@@ -271,6 +285,9 @@ struct config
   int nall;      /**< total number of grid cells */
   int rank;      /**< my rank */
   int ntask;     /**< number of parallel tasks */
+  int nthreads;  /**< number of OpenMP threads per task */
+  int decomposition; /**< domain decomposition (EQUAL_DECOMPOSITION, COST_DECOMPOSITION, BASIN_DECOMPOSITION) */
+  int *cellcounts; /**< number of grid cells of each task */
   int count;     /**< number of grid cells with valid soilcode */
   int fire;      /**< fire disturbance enabled */
   int seed_start;      /**< initial seed for random number generator */
@@ -282,6 +299,7 @@ struct config
   Bool extflow;        /** external flow enabled */
   Bool percolation_heattransfer; /**< water heat transfer enabled */
   Bool johansen;       /**< johansen enabled */
+  int lambda_solver;   /**< root finding for Ci/Ca ratio in water_stressed() (BISECT_SOLVER, ILLINOIS_SOLVER) */
   Bool gsi_phenology;	/**< GSI phenology enabled (TRUE/FALSE) */
   Bool transp_suction_fcn; /**< transpiration reduction function enabled */
   Bool equilsoil;      /**< equilsoil is called */
@@ -293,6 +311,7 @@ struct config
   int crop_phu_option;    /**< crop phu option (old LPJmL4, semistatic internally computed, prescribed  */
   Bool initsoiltemp;
   Pnet *route;         /**< river routing network */
+  Real *fin_local;     /**< inflow from cells of the same task used by drain() */
   Pnet *irrig_neighbour; /**< irrigation neighbour network */
   Pnet *irrig_back;      /**< back irrigation network */
   Pnet *irrig_res;
@@ -395,6 +414,9 @@ extern void freeconfig_netcdf(Netcdf_config *);
 extern void createconfig(const Config *);
 extern Bool checkuniqoutput(int,int,const Config *);
 extern void closeconfig(LPJfile *);
+extern Bool getcostcounts(int [],const char *,const Config *);
+extern Bool getbasincounts(int [],const Config *);
+extern void getgridcounts(int [],int [],int,const Config *);
 
 /* Definition of macros */
 
@@ -28,6 +28,7 @@ extern int addhashitem(Hash,char *,void *);
 extern Bool removehashitem(Hash,const char *);
 extern int gethashcount(const Hash);
 extern void *gethashitem(Hash,const char *);
+extern Bool findhashitem(Hash,const char *,Hashitem *);
 extern Hashitem *hash2array(const Hash);
 extern void deletehash(Hash);
 extern void freehash(Hash);
@@ -73,6 +73,8 @@
 #define LPJ_KBF_VERSION 2
 #define LPJ_LSUHA_HEADER "LPJLIVE"
 #define LPJ_LSUHA_VERSION 2
+#define LPJ_COST_HEADER "LPJCOST"
+#define LPJ_COST_VERSION 3
 #define CELLYEAR 1
 #define YEARCELL 2
 #define CELLINDEX 3
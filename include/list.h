@@ -21,6 +21,7 @@ typedef struct
 {
   void **data; /* array of pointers to data */
   int n;       /* Length of list */
+  int size;    /* allocated length of array, grows by doubling */
 } List;
 
 /* Declaration of functions */
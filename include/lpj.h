@@ -42,6 +42,9 @@
 #ifdef USE_MPI
 #include <mpi.h> /* Include MPI header for parallel program */
 #endif
+#ifdef USE_OPENMP
+#include <omp.h> /* Include OpenMP header for multithreaded program */
+#endif
 
 /* Definition of datatypes */
 
@@ -58,6 +61,7 @@ typedef struct netcdf_config Netcdf_config; /* forward declaration of NetCDF set
 #endif
 #include "list.h"
 #include "types.h"
+#include "mempool.h"
 #include "hash.h"
 #include "bstruct.h"
 #include "swap.h"
@@ -78,6 +82,7 @@ typedef struct netcdf_config Netcdf_config; /* forward declaration of NetCDF set
 #include "manage.h"
 #include "config.h"
 #include "cdf.h"
+#include "writequeue.h"
 #include "outfile.h"
 #include "param.h"
 #include "climate.h"
@@ -132,7 +137,7 @@ extern char *lpj_usage;
 
 extern Cell *newgrid(Config *,const Standtype [],int,int,int);
 extern Bool fwriterestart(const Cell[],int,int,int,const char *,Bool,const Config *);
-extern Bstruct openrestart(const char *,Config *,int,int);
+extern Bstruct openrestart(const char *,Config *,int,int,Bool);
 extern void copyright(const char *);
 extern void printlicense(void);
 extern void help(const char *);
@@ -140,10 +145,10 @@ extern void fprintflux(FILE *file,Flux,Real,int,const Config *);
 extern void fprintcsvflux(FILE *file,Flux,Real,Real,int,const Config *);
 extern void failonerror(const Config *,int,int,const char *);
 extern void fprinttiming(FILE *,double,const Config *);
+extern Bool fwritetiming(const char *,double,const Config *);
 #ifdef USE_MPI
 extern Bool iserror(int,const Config *);
-extern void sendhash(const Hash,int,MPI_Comm);
-extern void receivehash(Hash,int,MPI_Comm);
+extern void mergehash(Hash,const Hash,MPI_Comm);
 #else
 #define iserror(rc,config) rc
 #endif
@@ -153,5 +158,10 @@ extern void receivehash(Hash,int,MPI_Comm);
 #define printflux(flux,total,year,config) fprintflux(stdout,flux,total,year,config)
 #define printcsvflux(flux,total,scale,year,config) fprintcsvflux(stdout,flux,total,scale,year,config)
 #define printtiming(total,config) fprinttiming(stdout,total,config)
+#ifdef USE_OPENMP
+#define getthreadnum() omp_get_thread_num()
+#else
+#define getthreadnum() 0
+#endif
 
 #endif
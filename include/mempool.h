@@ -0,0 +1,44 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                  m  e  m  p  o  o  l  .  h                                     \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Header file for pool allocator of objects of fixed size                    \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#ifndef MEMPOOL_H /* Already included? */
+#define MEMPOOL_H
+
+/* Definition of datatypes */
+
+typedef struct
+{
+  void *free;  /**< list of free objects */
+  void *chunk; /**< list of allocated chunks */
+  int n;       /**< number of objects in next chunk */
+} Mempoollist;
+
+typedef struct
+{
+  size_t size;       /**< size of objects in bytes */
+  int n;             /**< number of objects in first chunk */
+  int nthreads;      /**< number of threads */
+  Mempoollist *list; /**< free lists for each thread or NULL */
+} Mempool;
+
+/* Declaration of functions */
+
+extern Bool initmempool(Mempool *,size_t,int,int);
+extern void *getmempoolitem(Mempool *);
+extern void putmempoolitem(Mempool *,void *);
+extern void freemempool(Mempool *);
+
+#endif
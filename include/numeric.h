@@ -36,6 +36,7 @@ typedef int Seed[NSEED]; /* Seed for randfrac() random number generator */
 /* Declaration of functions */
 
 extern Real bisect(Real (*)(Real,void *),Real,Real,void *,Real,Real,int,int *); /* find zero */
+extern Real illinois(Real (*)(Real,void *),Real,Real,Real,Real,void *,Real,Real,int,int *); /* find zero */
 extern Real leftmostzero(Real (*)(Real,void *),Real,Real,void *,Real,Real,int); /* find leftmost zero */
 extern void linreg(Real *,Real *,const Real[],int); /* linear regression */
 extern void setseed(Seed,int); /* set seed of random number generator */
@@ -54,6 +55,7 @@ extern void interpolate_data(Real *, Real *, Real *, int n, Real);
 extern void permute(int [],int,Seed);
 extern Bool apply_finite_volume_diffusion_of_a_day(Real *, const int, const Real *, const Real, const Real *, const Real *);
 extern Bool apply_finite_volume_diffusion_impl(Real *, const int, const Real *, const Real, const Real *, const Real *, const Real);
+extern Bool apply_finite_volume_diffusion_impl_batch(Real *, const int, const int, const Real *, const Real *, const Real *, const Real *, const Real);
 extern void finite_volume_diffusion_timestep(Real *, const int, Real,const Real *, const Real, const Real *, const Real *);
 extern void calculate_resistances(Real *, const Real *, const Real *, const int);
 Bool apply_finite_volume_diffusion_impl_crank_nicolson(Real * amount,             /* g/m^2, substance absolute amount */
@@ -65,6 +67,7 @@ Bool apply_finite_volume_diffusion_impl_crank_nicolson(Real * amount,
                                            const Real dt
                                            );
 extern void thomas_algorithm(const Real *, const Real *, const Real *, const Real *, Real *, const int n);
+extern void thomas_algorithm_batch(const Real *, const Real *, const Real *, const Real *, Real *, const int, const int);
 
 #ifndef USE_RAND48
 /* if erand48() function is not defined, use randfrac instead */
@@ -17,6 +17,8 @@
 #ifndef OUTFILE_H
 #define OUTFILE_H
 
+#define WRITEQUEUE_SIZE 64 /* number of buffers in asynchronous write queue */
+
 /* Definition of datatypes */
 
 typedef struct
@@ -28,6 +30,11 @@ typedef struct
   Bool oneyear;      /**< separate output files for each year (TRUE/FALSE) */
   Bool compress;     /**< compress file after write (TRUE/FALSE) */
   const char *filename;
+#ifdef USE_MPI
+  Bool isparallel;   /**< each task writes its data directly into file (TRUE/FALSE) */
+  MPI_File fh;       /**< MPI-IO file handle for parallel write */
+  MPI_Offset pos;    /**< current position in file for parallel write */
+#endif
   union
   { 
     FILE *file;        /**< file pointer */
@@ -40,9 +47,11 @@ typedef struct
 #ifdef USE_MPI
   int *counts;         /**< sizes for MPI_Gatherv */
   int *offsets;        /**< offsets for MPI_Gatherv */
+  Bool isasync;        /**< output is gathered and written by writer thread of root task (TRUE/FALSE) */
 #endif
   File *files;
   int n;          /**< size of File array */
+  Writequeue queue; /**< asynchronous write queue or NULL */
   Coord_array *index;
   Coord_array *index_all;
 } Outputfile;
@@ -56,4 +65,9 @@ extern Coord_array *createcoord(Outputfile *,const Cell *,const Config *);
 extern Coord_array *createcoord_all(const Cell *,const Config *);
 extern Coord_array *createindex(const Coord *,int,Coord,Bool,Bool);
 extern void outputnames(Outputfile *,const Config *);
+#ifdef USE_MPI
+extern Bool mpi_write_file(File *,void *,MPI_Datatype,int,int *,int *,int,MPI_Comm);
+extern Bool mpi_write_queue(Writequeue,int,FILE *,Netcdf *,void *,MPI_Datatype,int,Real,Real,
+                            int,int,int *,int *,int,char,MPI_Comm);
+#endif
 #endif
@@ -77,6 +77,13 @@ typedef struct
   Real wscal; /**< daily water limiting function value for phenology */
 } Phenology;  /* new phenology */
 
+typedef struct
+{
+  Real temp;      /**< temperature (deg C) */
+  Real fac;       /**< kc*(1+po2/ko) for C3 photosynthesis (Pa) */
+  Real gammastar; /**< CO2 compensation point for C3 photosynthesis (Pa) */
+} Photocoeff;     /* temperature-dependent coefficients of photosynthesis */
+
 typedef struct
 {
   Real sl;   /**< steepness of the response function */
@@ -233,6 +240,7 @@ typedef struct Pft
   Real wscal_mean;
   Real phen,aphen;
   Real vmax;
+  Real lambda;           /**< Ci/Ca ratio of previous day, start value for root finding in water_stressed() */
   Real b;                /**< leaf respiration as fraction of vmax acclimated to mean temperature in vegetative period */
   Real nleaf;            /**< nitrogen in leaf (gN/m2) */
   Real vscal;            /**< nitrogen stress scaling factor for allocation, used as mean for trees and grasses, initialized daily for crops */
@@ -270,7 +278,8 @@ extern void newpft(Pft *,Stand *,const Pftpar *,int,int,const Config *);
 extern void freepft(Pft *);
 extern void freepftpar(Pftpar [],int);
 extern Real temp_stress(const Pftpar *,Real,Real);
-extern Real photosynthesis(Real *,Real *,Real *,int,Real,Real,Real,Real,Real,Real,Real,Bool);
+extern Real photosynthesis(Real *,Real *,Real *,int,Real,Real,Real,Real,const Photocoeff *,Real,Real,Bool);
+extern void photocoeff(Photocoeff *,Real);
 extern Bool survive(const Pftpar *,const Climbuf *);
 extern Real interception(Real *,const Pft *,Real,Real);
 extern void initgdd(Real [],int);
@@ -21,6 +21,7 @@ typedef struct
 {
   Pft *pft; /* PFT array */
   int n;    /* size of PFT array */
+  int size; /* allocated size of PFT array, grows by doubling */
 } Pftlist;
 
 /* Declaration of functions */
@@ -25,7 +25,7 @@
 
 /* Definition of constants */
 
-#define PNET_VERSION "1.0.5"
+#define PNET_VERSION "1.0.6"
 
 /* Return codes for Pnet functions */
 
@@ -42,6 +42,8 @@ typedef struct
 #ifdef USE_MPI
   MPI_Comm comm;     /* MPI communicator */
   MPI_Datatype type; /* MPI datatype of grid element */
+  int nreq;          /* number of persistent requests */
+  MPI_Request *req;  /* persistent send and receive requests to neighbours */
 #else
   int size;          /* size of grid element */
 #endif
@@ -64,7 +66,7 @@ typedef struct
 /* Declaration of functions */
 
 #ifdef USE_MPI
-extern Pnet *pnet_init(MPI_Comm,MPI_Datatype,int);
+extern Pnet *pnet_init(MPI_Comm,MPI_Datatype,int,const int *);
 #else
 extern Pnet *pnet_init(int,int);
 #endif
@@ -74,12 +76,13 @@ extern int pnet_reverse(Pnet *);
 extern void pnet_free(Pnet *);
 extern int pnet_addconnect(Pnet *,int,int);
 extern char *pnet_strerror(int);
+#ifdef USE_MPI
+extern void pnet_exchg(Pnet *);
+#endif
 
 /* Definitions of macros */
 
-#ifdef USE_MPI
-#define pnet_exchg(pnet) MPI_Alltoallv(pnet->outbuffer,pnet->outlen,pnet->outdisp,pnet->type,pnet->inbuffer,pnet->inlen,pnet->indisp,pnet->type,pnet->comm)
-#else
+#ifndef USE_MPI
 #define pnet_exchg(pnet) memcpy(pnet->inbuffer,pnet->outbuffer,pnet->size*pnet->inlen[0])
 #endif
 #define pnet_foreach(pnet,i) for(i=pnet->lo;i<=pnet->hi;i++)
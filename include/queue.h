@@ -26,6 +26,7 @@ extern void freequeue(Queue);
 extern Real getqueue(const Queue,int);
 extern void putqueue(Queue,Real);
 extern Real sumqueue(const Queue);
+extern Real convqueue(const Queue,const Real []);
 extern Bool fwritequeue(Bstruct,const char *,const Queue);
 extern Queue freadqueue(Bstruct,const char *);
 extern void freequeue(Queue);
@@ -178,6 +178,7 @@ typedef struct
   Real avg_fbd[NFUELCLASS+1]; /**< average fuel bulk densities */
   Litteritem *item;           /**< litter list for PFTs */
   int n;                      /**< number of litter pools */
+  int size;                   /**< allocated number of litter pools, grows by doubling */
   Real agtop_wcap;            /**< capacity of ag litter to store water in mm */
   Real agtop_moist;           /**< amount of water stored in ag litter in mm */
   Real agtop_cover;           /**< fraction of soil coverd by ag litter */
@@ -304,6 +305,17 @@ typedef struct
  * uniformly above/below zero, or mixed or unknown */
 typedef enum {ALL_BELOW_0, MIXED_SIGN, ALL_ABOVE_0, UNKNOWN} Uniform_temp_sign;
 
+/* thermal properties of many stands, each array holds NHEATGRIDP rows
+ * with the stand index innermost, see Soil_thermal_prop */
+typedef struct
+{
+  Real *lam_frozen;    /**< conductivity of soil in frozen state [W/K/m] */
+  Real *lam_unfrozen;  /**< conductivity of soil in unfrozen state [W/K/m] */
+  Real *c_frozen;      /**< heat capacity of soil in frozen state [J/m3/K] */
+  Real *c_unfrozen;    /**< heat capacity of soil in unfrozen state [J/m3/K] */
+  Real *latent_heat;   /**< latent heat of fusion of soil [J/m3] */
+} Soil_thermal_prop_batch;
+
 
 struct Pftpar; /* forward declaration */
 struct Dailyclimate; /* forward declaration */
@@ -362,6 +374,7 @@ extern Real soilwater(const Soil *);
 extern Real rootwater(const Soil *);
 extern Real satwater(const Soil *);
 extern void apply_heatconduction_of_a_day(Uniform_temp_sign, Real *, const Real *, Real, const Soil_thermal_prop *);
+extern void apply_heatconduction_of_a_day_batch(int, int, const Uniform_temp_sign *, Real *, const Real *, const Real *, const Soil_thermal_prop_batch *);
 extern void calc_soil_thermal_props(Uniform_temp_sign, Soil_thermal_prop *, const Soil *, const Real *, const Real * , Bool, Bool);
 extern void compute_mean_layer_temps_from_enth(Real *, const Real *,const  Soil_thermal_prop *);
 extern void apply_enth_of_untracked_mass_shifts(Real *, const Real *, const Real *, const Real *, const Real *);
@@ -372,6 +385,8 @@ extern void gasdiffusion(Soil*, Real, Real, Real *, Real *, Real *,const Real *,
 extern Real soilmethane(const Soil *);
 extern Real temp_response(Real, Real);
 extern void update_soil_thermal_state(Soil *,Real,const Config *);
+extern void setup_soil_heatconduction(Uniform_temp_sign *,Soil_thermal_prop *,Real [],Soil *,Real,const Config *);
+extern void update_soil_thermal_attributes(Soil *,Real,const Soil_thermal_prop *);
 extern Real litter_agtop_tree(const Litter *,int);
 extern Real litter_agtop_nitrogen_tree(const Litter *,int);
 extern Real biologicalnfixation(const Stand *,int,int,const Config *);
@@ -17,6 +17,10 @@
 #ifndef STAND_H  /* Already included? */
 #define STAND_H
 
+/* Definition of constants */
+
+#define STANDPOOL_CHUNK 64 /* number of stands in first chunk of stand pool */
+
 /* Definition of datatypes */
 
 typedef struct
@@ -55,6 +59,10 @@ struct stand
 typedef List *Standlist;
 typedef struct landcover *Landcover;
 
+/* Declaration of variables */
+
+extern Mempool standpool; /* pool for stand objects */
+
 /* Declaration of functions */
 
 extern Bool fwritestand(Bstruct,const char *,const Stand *,int);
@@ -99,6 +107,9 @@ extern void freelandcover(Landcover,Bool);
 
 /* Definition of macros */
 
+#define allocstand() (Stand *)getmempoolitem(&standpool)
+#define releasestand(stand) putmempoolitem(&standpool,stand)
+
 #define getstand(list,index) ((Stand *)getlistitem(list,index))
 #define foreachstand(stand,i,list) for(i=0;i<getlistlen(list) && (stand=getstand(list,i));i++)
 #define check_stand_fracs(cell,lakefrac) check_stand_fracs2(cell,lakefrac,__FUNCTION__,__LINE__)
@@ -19,16 +19,21 @@
 
 typedef enum
 {
+  DAILY_AGRICULTURE_FCN,
+  DAILY_GRASSLAND_FCN,
   DAILY_LITTERSOM_FCN,
+  DAILY_NATURAL_FCN,
   DRAIN_FCN,
   FOPENOUTPUT_FCN,
   FWRITERESTART_FCN,
   FWRITEOUTPUT_FCN,
   GASDIFFUSION_FCN,
   GETCLIMATE_FCN,
+  INFIL_PERC_FCN,
   INITINPUT_FCN,
   INITOUTPUT_FCN,
   IRRIG_AMOUNT_RESERVOIR_FCN,
+  LANDUSECHANGE_FCN,
   MPI_BARRIER_FCN,
   MPI_INIT_FCN,
   NEWGRID_FCN,
@@ -38,6 +43,7 @@ typedef enum
   SETUPANNUAL_GRID_FCN,
   STORECLIMATE_FCN,
   UPDATE_DAILY_CELL_FCN,
+  UPDATE_SOIL_THERMAL_STATE_FCN,
   UPDATEDAILY_GRID_FCN,
   WATER_STRESSED_FCN,
   WATERUSE_FCN,
@@ -49,11 +55,20 @@ typedef enum
 /* Declaration of variables */
 
 extern double timing[N_FCN];
+extern double timing_nested[N_FCN+1][N_FCN];
 extern char *timing_fcn[N_FCN];
 
+/* Declaration of functions */
+
+extern void timing_push(Timing_id);
+extern void timing_pop(Timing_id,double);
+
 /* Definition of macros */
 
-#define timing_start(t) t=mrun()
-#define timing_stop(id,t) timing[id]+=mrun()-t
+#define NO_PARENT N_FCN /* region is not nested in another region */
+#define TIMING_DEPTH 16 /* maximum depth of nested regions */
+
+#define timing_start(id,t) { timing_push(id); t=mrun(); }
+#define timing_stop(id,t) timing_pop(id,mrun()-t)
 
 #endif
@@ -145,7 +145,6 @@ extern long long getfilesizep(FILE *);
 extern const char *strippath(const char *);
 extern long long diskfree(const char *);
 extern void fprintintf(FILE *,long long);
-extern void getcounts(int [],int [],int,int,int);
 extern char *getbuilddate(void);
 extern char *gethash(void);
 extern char *getrepo(void);
@@ -169,6 +168,7 @@ extern void fprintattrs(FILE *,const Attr *,int);
 extern void freeattrs(Attr *,int);
 extern void fprinttime(FILE *,int);
 extern Bool readrealvec(FILE *,Real *,Real,Real,size_t,Bool,Type);
+extern Bool convertrealvec(const void *,Real *,Real,Real,size_t,Bool,Type);
 extern Bool readfloatvec(FILE *,float *,float,size_t,Bool,Type);
 extern Bool readintvec(FILE *,int *,size_t,Bool,Type);
 extern Bool readuintvec(FILE *,unsigned int *,size_t,Bool,Type);
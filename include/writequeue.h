@@ -0,0 +1,34 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              w  r  i  t  e  q  u  e  u  e  .  h                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Declaration of asynchronous write queue for output files                   \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#ifndef WRITEQUEUE_H /* Already included? */
+#define WRITEQUEUE_H
+
+/* Definition of datatypes */
+
+typedef struct writequeue *Writequeue;
+
+/* Declaration of functions */
+
+extern Writequeue newwritequeue(int);
+extern Bool putwritequeue(Writequeue,int,FILE *,Netcdf *,Type,const void *,
+                          int,Real,Real,int,int,char);
+extern Bool putflushqueue(Writequeue,int,FILE *,Netcdf *);
+extern Bool syncwritequeue(Writequeue);
+extern Bool syncnetcdfqueue(Writequeue);
+extern Bool freewritequeue(Writequeue);
+
+#endif
@@ -1,9 +1,10 @@
 /**************************************************************************************/
 /**                                                                                \n**/
-/**                  g  e  t  c  o  u  n  t  s  .  c                               \n**/
+/** b  s  t  r  u  c  t  _  c  l  o  s  e  z  s  t  r  u  c  t  .  c               \n**/
 /**                                                                                \n**/
-/**     Function computes counts and offsets used by MPI_Gatherv/                  \n**/
-/**     MPI_Scatterv                                                               \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
 /**                                                                                \n**/
 /** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
 /** authors, and contributors see AUTHORS file                                     \n**/
@@ -13,25 +14,18 @@
 /**                                                                                \n**/
 /**************************************************************************************/
 
-#include <stdio.h>
-#include "types.h"
+#include "bstruct_intern.h"
 
-void getcounts(int counts[], /**< number of cells for each task */
-               int offsets[], /**< cell offsets for each task */
-               int size,      /**< total number of cells */
-               int n,         /**< number of item per cell */
-               int tasks      /**< number of tasks */
-              )
+void bstruct_closezstruct(Bstruct bstr /**< pointer to restart file */
+                         )
 {
-  int i;
-  for(i=0;i<tasks;i++)
+  /* Function continues reading after compressed struct if all data of
+   * the uncompressed struct have been read */
+  if(bstr->iszstruct && bstr->pos==bstr->memsize)
   {
-    counts[i]=size/tasks;
-    if(i<size % tasks)
-      counts[i]++;
-    counts[i]*=n;
+    bstr->mem=bstr->outer.mem;
+    bstr->memsize=bstr->outer.memsize;
+    bstr->pos=bstr->outer.pos;
+    bstr->iszstruct=FALSE;
   }
-  offsets[0]=0;
-  for(i=1;i<tasks;i++)
-    offsets[i]=offsets[i-1]+counts[i-1];
-} /* of 'getcounts' */
+} /* of 'bstruct_closezstruct' */
@@ -40,6 +40,35 @@ static long long findname(Bstruct bstruct, /**< pointer to restart file */
   return -1; /* name not found */
 }  /* of 'findname' */
 
+static Bool getid(Bstruct bstruct, /**< pointer to restart file */
+                  const char *name, /**< name to search for */
+                  Id *id            /**< [out] id of name */
+                 )                  /** \return TRUE if name is not in name table */
+{
+  /* Function gets id of name. Names are mostly string constants, so ids are
+     cached by the address of the name and the name table is only searched
+     on the first call */
+  Hashitem *item,key;
+  int slot;
+  slot=((size_t)name>>3) & (BSTRUCT_NAMECACHE-1);
+  if(bstruct->namecache[slot].name==name && !strcmp(bstruct->namecache[slot].key,name))
+  {
+    *id=bstruct->namecache[slot].id;
+    return FALSE;
+  }
+  key.key=(char *)name;
+  /* Using binary search for finding the name in the ordered name table */
+  item=bsearch(&key,bstruct->names,bstruct->count,sizeof(Hashitem),bstruct_cmpname);
+  if(item==NULL)
+    return TRUE;
+  *id=*((Id *)item->data);
+  /* store name in name table in cache, name may be changed by caller */
+  bstruct->namecache[slot].key=item->key;
+  bstruct->namecache[slot].name=name;
+  bstruct->namecache[slot].id=*id;
+  return FALSE;
+} /* of 'getid' */
+
 Var *bstruct_findvar(Bstruct bstruct, /**< pointer to restart file */
                      Id id            /**< id to search for */
                     )                 /**< return pointer to variable or NULL */
@@ -62,8 +91,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
                        )                     /** \return TRUE if name was not found */
 {
   /* Function finds object with specified name in struct */
-  Id *id,id2;
-  Hashitem *item,key;
+  Id id,id2;
   Var *var;
   long long filepos;
 #ifdef DEBUG_BSTRUCT
@@ -105,16 +133,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
       }
       return TRUE;
     }
-    key.key=strdup(name);
-    if(key.key==NULL)
-    {
-      printallocerr("key");
-      return TRUE;
-    }
-    /* Using binary search for finding the name in the ordered name table */
-    item=bsearch(&key,bstr->names,bstr->count,sizeof(Hashitem),bstruct_cmpname);
-    free(key.key);
-    if(item==NULL)
+    if(getid(bstr,name,&id))
     {
       /* not found, return with error */
       if(bstr->isout)
@@ -124,17 +143,16 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
         bstruct_printnamestack(bstr);
       }
       /* undo last read */
-      fseek(bstr->file,-1,SEEK_CUR);
+      bstruct_seek(bstr,-1,SEEK_CUR);
       return TRUE;
     }
-    id=item->data;
 #ifdef DEBUG_BSTRUCT
-    printf("Object '%s' is %d\n",name,*id);
+    printf("Object '%s' is %d\n",name,id);
 #endif
     if(*token==BSTRUCT_ENDSTRUCT || *token==BSTRUCT_END)
     {
        /* find name in the list of already read objects */
-       filepos=findname(bstr,token,*id);
+       filepos=findname(bstr,token,id);
        if(filepos==-1)
        {
          /* not found, return with error */
@@ -145,11 +163,11 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
            bstruct_printnamestack(bstr);
          }
          /* undo last read */
-         fseek(bstr->file,-1,SEEK_CUR);
+         bstruct_seek(bstr,-1,SEEK_CUR);
          return TRUE;
        }
        /* found, goto object position */
-       fseek(bstr->file,filepos,SEEK_SET);
+       bstruct_seek(bstr,filepos,SEEK_SET);
        return FALSE;
     }
     /* read object name */
@@ -179,7 +197,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
       }
       return TRUE;
     }
-    if(*id!=id2)
+    if(id!=id2)
     {
       /* name not found, search for it */
       do
@@ -193,7 +211,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
             printallocerr("var");
             return TRUE;
           }
-          var->filepos=ftell(bstr->file);
+          var->filepos=bstruct_getpos(bstr);
           var->token=*token;
           var->id=id2;
           var->isread=FALSE;
@@ -206,7 +224,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
           }
         }
 #ifdef DEBUG_BSTRUCT
-        printf("%s=%d not found, %d\n",name,*id,id2);
+        printf("%s=%d not found, %d\n",name,id,id2);
 #endif
         if(bstruct_skipdata(bstr,*token))
         {
@@ -219,7 +237,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
           return TRUE;
         }
         /* read next token */
-        if(fread(token,1,1,bstr->file)!=1)
+        if(bstruct_read(bstr,token,1))
         {
           if(bstr->isout)
           {
@@ -242,7 +260,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
         if(*token==BSTRUCT_ENDSTRUCT || *token==BSTRUCT_END)
         {
           /* find name in the list of already read objects */
-          filepos=findname(bstr,token,*id);
+          filepos=findname(bstr,token,id);
           if(filepos==-1)
           {
             /* not found, return with error */
@@ -254,11 +272,11 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
               bstruct_printnamestack(bstr);
             }
             /* undo last read */
-            fseek(bstr->file,-1,SEEK_CUR);
+            bstruct_seek(bstr,-1,SEEK_CUR);
             return TRUE;
           }
           /* found, goto object position */
-          fseek(bstr->file,filepos,SEEK_SET);
+          bstruct_seek(bstr,filepos,SEEK_SET);
           return FALSE;
         }
         if(*token==BSTRUCT_ENDARRAY)
@@ -295,7 +313,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
           }
           return TRUE;
         }
-      }while(*id!=id2);
+      }while(id!=id2);
     }
     var=bstruct_findvar(bstr,id2);
     if(var==NULL)
@@ -306,7 +324,7 @@ Bool bstruct_findobject(Bstruct bstr,        /**< pointer to restart file */
         printallocerr("var");
         return TRUE;
       }
-      var->filepos=ftell(bstr->file);
+      var->filepos=bstruct_getpos(bstr);
       var->token=*token;
       var->id=id2;
       var->isread=TRUE;
@@ -15,6 +15,9 @@
 /**************************************************************************************/
 
 #include "bstruct_intern.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
                    )                /** \return TRUE on error */
@@ -33,9 +36,9 @@ Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
     {
       /* write end token */
       token=BSTRUCT_END;
-      fwrite(&token,sizeof(token),1,bstruct->file);
+      bstruct_write(bstruct,&token,sizeof(token));
       /* save position of start of name table */
-      filepos=ftell(bstruct->file);
+      filepos=bstruct_tell(bstruct);
       /* convert hash table into array */
       list=hash2array(bstruct->hash);
       if(list==NULL)
@@ -49,17 +52,17 @@ Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
       qsort(list,count,sizeof(Hashitem),bstruct_cmpname);
       /* write name table at end of restart file */
       /* write size of name table */
-      fwrite(&count,sizeof(int),1,bstruct->file);
+      bstruct_write(bstruct,&count,sizeof(int));
       for(i=0;i<count;i++)
       {
         len=strlen(list[i].key);
         /* write name length */
-        fwrite(&len,1,1,bstruct->file);
+        bstruct_write(bstruct,&len,1);
         /* write name */
-        fwrite(list[i].key,len,1,bstruct->file);
+        bstruct_write(bstruct,list[i].key,len);
         /* write corresponding id */
         id=list[i].data;
-        if(fwrite(id,sizeof(short),1,bstruct->file)!=1)
+        if(bstruct_write(bstruct,id,sizeof(short)))
         {
           fprintf(stderr,"ERROR529: Cannot write name table.\n");
           rc=TRUE;
@@ -70,9 +73,17 @@ Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
 #endif
       }
       free(list);
-      /* write file position of name table after file header */
-      fseek(bstruct->file,strlen(BSTRUCT_HEADER)+sizeof(int),SEEK_SET);
-      fwrite(&filepos,sizeof(filepos),1,bstruct->file);
+      if(bstruct_flush(bstruct))
+      {
+        fprintf(stderr,"ERROR529: Cannot write name table.\n");
+        rc=TRUE;
+      }
+      if(bstruct->file!=NULL)
+      {
+        /* write file position of name table after file header */
+        fseek(bstruct->file,strlen(BSTRUCT_HEADER)+sizeof(int),SEEK_SET);
+        fwrite(&filepos,sizeof(filepos),1,bstruct->file);
+      }
       freehash(bstruct->hash);
       if(bstruct->level>1)
       {
@@ -82,7 +93,7 @@ Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
         rc=TRUE;
       }
     }
-    else if(bstruct->namestack[bstruct->level-1].varnames!=NULL)
+    else if(bstruct->level>0 && bstruct->namestack[bstruct->level-1].varnames!=NULL)
     {
       foreachlistitem(i,bstruct->namestack[bstruct->level-1].varnames)
       {
@@ -97,7 +108,19 @@ Bool bstruct_finish(Bstruct bstruct /**< pointer to open restart file */
       }
     }
     bstruct_freenamestack(bstruct);
-    fclose(bstruct->file);
+    if(bstruct->file!=NULL)
+    {
+      if(bstruct_flush(bstruct))
+        rc=TRUE;
+      fclose(bstruct->file);
+    }
+#ifndef _WIN32
+    if(bstruct->ismapped)
+      munmap((void *)bstruct->mem,bstruct->memsize);
+#endif
+    free(bstruct->buf); /* free buffer of data read by bstruct_loadarray() */
+    free(bstruct->block);
+    free(bstruct->zbuf);
     /* free name table */
     for(i=0;i<bstruct->count;i++)
     {
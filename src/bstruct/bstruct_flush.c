@@ -0,0 +1,30 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**         b  s  t  r  u  c  t  _  f  l  u  s  h  .  c                            \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_flush(Bstruct bstr /**< pointer to restart file */
+                  )             /** \return TRUE on error */
+{
+  /* Function writes block of data in memory to file with one call of fwrite() */
+  Bool rc=FALSE;
+  if(bstr->file!=NULL && bstr->blocklen>0)
+  {
+    rc=fwrite(bstr->block,1,bstr->blocklen,bstr->file)!=bstr->blocklen;
+    bstr->blocklen=0;
+  }
+  return rc;
+} /* of 'bstruct_flush' */
@@ -19,6 +19,13 @@
 void bstruct_freehash(Bstruct bstruct /**< pointer to restart file */
                      )
 {
+  int i;
   freehash(bstruct->hash);
   bstruct->hash=NULL;
+  /* cached ids are no longer valid */
+  for(i=0;i<BSTRUCT_NAMECACHE;i++)
+  {
+    bstruct->namecache[i].key=NULL;
+    bstruct->namecache[i].name=NULL;
+  }
 } /* of 'bstruct_freehash' */
@@ -20,5 +20,5 @@ long long bstruct_getarrayindex(Bstruct bstr)
 {
   bstr->namestack[bstr->level-1].type=BSTRUCT_BEGINARRAY;
   bstr->namestack[bstr->level-1].size=bstr->namestack[bstr->level-1].nr+1;
-  return ftell(bstr->file);
+  return bstruct_tell(bstr);
 } /* of 'bstruct_getarrayindex' */
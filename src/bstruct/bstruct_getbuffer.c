@@ -0,0 +1,26 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**   b  s  t  r  u  c  t  _  g  e  t  b  u  f  f  e  r  .  c                      \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+const char *bstruct_getbuffer(Bstruct bstruct, /**< pointer to restart object in memory */
+                              size_t *size     /**< [out] size of buffer in bytes */
+                             )                 /** \return pointer to data written */
+{
+  /* Buffer is only valid until next write or bstruct_finish() */
+  *size=bstruct->blocklen;
+  return bstruct->block;
+} /* of 'bstruct_getbuffer' */
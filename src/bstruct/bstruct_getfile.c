@@ -19,5 +19,7 @@
 FILE *bstruct_getfile(Bstruct bstruct /**< pointer to restart file */
                      )                /** \return pointer to open file */
 {
+  /* write pending data in block to file */
+  bstruct_flush(bstruct);
   return bstruct->file;
 } /* of 'bstruct_getfile' */
@@ -0,0 +1,23 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**           b  s  t  r  u  c  t  _  g  e  t  n  a  m  e  p  o  s  .  c           \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+long long bstruct_getnamepos(const Bstruct bstruct /**< pointer to restart file */
+                            ) /** \return file position of name table or 0 if not known */
+{
+  return bstruct->namepos;
+} /* of 'bstruct_getnamepos' */
@@ -21,7 +21,7 @@ const size_t bstruct_typesizes[]={1,sizeof(short),sizeof(int),sizeof(float),
 
 char *bstruct_typenames[]={"byte","short","int","float","double","bool","bool","ushort",
                            "zero","fzero","null","string","string1","array","array1",
-                           "struct","indexarray","endstruct","endarray","end"};
+                           "struct","indexarray","endstruct","endarray","end","zstruct"};
 
 int bstruct_gethashkey(const char *key,int size)
 {
@@ -25,9 +25,9 @@ Bool bstruct_isdefined(Bstruct bstr,   /**< pointer to restart file */
   Bool rc;
   Byte token,isout;
   /* store file position */
-  pos=ftell(bstr->file);
+  pos=bstruct_getpos(bstr);
   /* read token */
-  if(fread(&token,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,&token,1))
     return FALSE;
   if(isinvalidtoken(token))
   {
@@ -42,6 +42,6 @@ Bool bstruct_isdefined(Bstruct bstr,   /**< pointer to restart file */
   rc=bstruct_findobject(bstr,&token,BSTRUCT_BYTE,key);
   bstr->isout=isout;
   /* restore position in file */
-  fseek(bstr->file,pos,SEEK_SET);
+  bstruct_seek(bstr,pos,SEEK_SET);
   return !rc;
 } /* of bstruct_isdefined' */
@@ -25,9 +25,9 @@ Bool bstruct_isnull(Bstruct bstr,    /**< pointer to restart file */
   Bool rc;
   Byte token;
   /* store file position */
-  pos=ftell(bstr->file);
+  pos=bstruct_getpos(bstr);
   /* read token */
-  if(fread(&token,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,&token,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading token.\n");
@@ -44,6 +44,6 @@ Bool bstruct_isnull(Bstruct bstr,    /**< pointer to restart file */
   if(!rc && (token & 63)==BSTRUCT_NULL)
     return TRUE;
   /* restore position in file */
-  fseek(bstr->file,pos,SEEK_SET);
+  bstruct_seek(bstr,pos,SEEK_SET);
   return FALSE;
 } /* of bstruct_isnull' */
@@ -0,0 +1,74 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**   b  s  t  r  u  c  t  _  l  o  a  d  a  r  r  a  y  .  c                      \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_loadarray(Bstruct bstr,    /**< pointer to restart file */
+                       int index,       /**< index of first array item to read */
+                       long long start, /**< file position of array item */
+                       long long end    /**< file position of end of data to read */
+                      )                 /** \return TRUE on error */
+{
+  /* Function reads data block of array items into memory with one read,
+   * subsequent reads are done from memory by pointer arithmetic */
+  char *buffer;
+  size_t size;
+  if(start<=0 || end<=start)
+  {
+    if(bstr->isout)
+      fprintf(stderr,"ERROR512: Invalid position [%lld,%lld] in array.\n",start,end);
+    return TRUE;
+  }
+  if(bstr->ismapped)
+  {
+    /* file is already mapped into memory, data need not to be copied */
+    if(end>(long long)bstr->memsize || bstruct_seek(bstr,start,SEEK_SET))
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR508: Unexpected end of file reading array at position %lld.\n",end);
+      return TRUE;
+    }
+    bstr->namestack[bstr->level-1].nr=index;
+    return FALSE;
+  }
+  if(bstruct_seek(bstr,start,SEEK_SET))
+  {
+    fprintf(stderr,"ERROR511: Cannot skip to file position %lld.\n",start);
+    return TRUE;
+  }
+  size=end-start;
+  buffer=malloc(size);
+  if(buffer==NULL)
+  {
+    printallocerr("buffer");
+    return TRUE;
+  }
+  if(bstruct_read(bstr,buffer,size))
+  {
+    if(bstr->isout)
+      fprintf(stderr,"ERROR508: Unexpected end of file reading %zu bytes of array.\n",size);
+    free(buffer);
+    return TRUE;
+  }
+  /* file positions are relative to start of buffer from now on */
+  free(bstr->buf);
+  bstr->buf=buffer;
+  bstr->mem=buffer;
+  bstr->memsize=size;
+  bstr->pos=0;
+  bstr->namestack[bstr->level-1].nr=index;
+  return FALSE;
+} /* of 'bstruct_loadarray' */
@@ -0,0 +1,68 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**      b  s  t  r  u  c  t  _  m  e  m  o  p  e  n  .  c                         \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bstruct bstruct_memopen(Bool isout /**< enable error output on stderr */
+                       )           /** \return pointer to restart object or NULL in case of error */
+{
+  /* Function creates restart object in memory. Data are written without
+   * file header and name table and can be retrieved by bstruct_getbuffer() */
+  Bstruct bstruct;
+  int i;
+  bstruct=new(struct bstruct);
+  if(bstruct==NULL)
+  {
+    printallocerr("bstruct");
+    return NULL;
+  }
+  bstruct->isout=isout;
+  /* Initialize name stack */
+  bstruct->level=1;
+  bstruct->namepos=0;
+  bstruct->namestack[0].type=BSTRUCT_BEGINSTRUCT;
+  bstruct->namestack[0].nr=0;
+  bstruct->namestack[0].size=0;
+  bstruct->namestack[0].varnames=NULL;
+  bstruct->namestack[0].name=NULL;
+  bstruct->names=NULL;
+  bstruct->names2=NULL;
+  bstruct->count=0;
+  bstruct->buf=NULL;
+  bstruct->block=NULL;
+  bstruct->blocklen=bstruct->blocksize=0;
+  bstruct->mem=NULL;
+  bstruct->memsize=bstruct->pos=0;
+  bstruct->ismapped=FALSE;
+  bstruct->compress=0;
+  bstruct->iszstruct=FALSE;
+  bstruct->zbuf=NULL;
+  bstruct->zbufsize=0;
+  for(i=0;i<BSTRUCT_NAMECACHE;i++)
+  {
+    bstruct->namecache[i].name=NULL;
+    bstruct->namecache[i].key=NULL;
+  }
+  bstruct->file=NULL; /* data are only written into block */
+  bstruct->hash=newhash(BSTRUCT_HASHSIZE,bstruct_gethashkey,free);
+  if(bstruct->hash==NULL)
+  {
+    printallocerr("hash");
+    free(bstruct);
+    return NULL;
+  }
+  return bstruct;
+} /* of 'bstruct_memopen' */
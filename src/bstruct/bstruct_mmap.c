@@ -0,0 +1,50 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**           b  s  t  r  u  c  t  _  m  m  a  p  .  c                             \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+Bool bstruct_mmap(Bstruct bstr /**< pointer to restart file opened by bstruct_open() */
+                 )             /** \return TRUE on error */
+{
+  /* Function maps restart file into memory. All subsequent reads are done
+   * by pointer arithmetic on the mapped pages instead of stdio calls.
+   * In case of error errno is set and data are still read from file */
+#ifdef _WIN32
+  errno=ENOSYS;
+  return TRUE;
+#else
+  struct stat buf;
+  void *map;
+  long long pos;
+  if(bstr->mem!=NULL)
+    return FALSE; /* data are already in memory */
+  pos=ftell(bstr->file);
+  if(pos<0 || fstat(fileno(bstr->file),&buf))
+    return TRUE;
+  map=mmap(NULL,buf.st_size,PROT_READ,MAP_SHARED,fileno(bstr->file),0);
+  if(map==MAP_FAILED)
+    return TRUE;
+  bstr->mem=map;
+  bstr->memsize=buf.st_size;
+  bstr->pos=pos;
+  bstr->ismapped=TRUE;
+  return FALSE;
+#endif
+} /* of 'bstruct_mmap' */
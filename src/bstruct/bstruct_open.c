@@ -54,7 +54,23 @@ Bstruct bstruct_open(const char *filename, /**< filename of restart file to open
   bstruct->imiss=0;
   bstruct->skipped=0;
   bstruct->level=1;
+  bstruct->namepos=0;
   bstruct->hash=NULL;
+  bstruct->buf=NULL;
+  bstruct->block=NULL;
+  bstruct->blocklen=bstruct->blocksize=0;
+  bstruct->mem=NULL;
+  bstruct->memsize=bstruct->pos=0;
+  bstruct->ismapped=FALSE;
+  bstruct->compress=0;
+  bstruct->iszstruct=FALSE;
+  bstruct->zbuf=NULL;
+  bstruct->zbufsize=0;
+  for(i=0;i<BSTRUCT_NAMECACHE;i++)
+  {
+    bstruct->namecache[i].name=NULL;
+    bstruct->namecache[i].key=NULL;
+  }
   bstruct->file=fopen(filename,"rb");
   if(bstruct->file==NULL)
   {
@@ -113,6 +129,7 @@ Bstruct bstruct_open(const char *filename, /**< filename of restart file to open
     free(bstruct);
     return NULL;
   }
+  bstruct->namepos=filepos;
   /* save file position and seek to table */
   save=ftell(bstruct->file);
   if(fseek(bstruct->file,filepos,SEEK_SET))
@@ -0,0 +1,38 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**           b  s  t  r  u  c  t  _  r  e  a  d  .  c                             \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_read(Bstruct bstr, /**< pointer to restart file */
+                  void *data,   /**< [out] data read */
+                  size_t size   /**< size of data in bytes */
+                 )              /** \return TRUE on error */
+{
+  /* Function reads data from memory if restart data are mapped or loaded
+   * into memory, otherwise from file */
+  if(bstr->mem!=NULL)
+  {
+    if(size>bstr->memsize-bstr->pos)
+    {
+      bstr->pos=bstr->memsize;
+      return TRUE;
+    }
+    memcpy(data,bstr->mem+bstr->pos,size);
+    bstr->pos+=size;
+    return FALSE;
+  }
+  return fread(data,1,size,bstr->file)!=size;
+} /* of 'bstruct_read' */
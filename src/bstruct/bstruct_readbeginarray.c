@@ -42,7 +42,7 @@ Bool bstruct_readbeginarray(Bstruct bstr,     /**< pointer to restart file */
   b&=63; /* strip top 2 bits in token */
   if(b==BSTRUCT_BEGINARRAY1)
   {
-    if(fread(&b,1,1,bstr->file)!=1)
+    if(bstruct_read(bstr,&b,1))
     {
       if(bstr->isout)
         fprintf(stderr,"ERROR512: Cannot read array length of '%s'.\n",getname(name));
@@ -59,7 +59,7 @@ Bool bstruct_readbeginarray(Bstruct bstr,     /**< pointer to restart file */
               getname(name),bstruct_typenames[b]);
     return TRUE;
   }
-  if(freadint(size,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,size,1,sizeof(int)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading array size of '%s'.\n",
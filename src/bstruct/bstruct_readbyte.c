@@ -39,7 +39,7 @@ Bool bstruct_readbyte(Bstruct bstr,     /**< pointer to restart file */
               getname(name),bstruct_typenames[token]);
     return TRUE;
   }
-  if(fread(value,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,value,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading bool '%s'.\n",
@@ -25,12 +25,24 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
   int string_length;
   Id id;
   data->name=NULL;
-  if(fread(&data->token,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,&data->token,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading token.\n");
     return TRUE;
   }
+  if(data->token==BSTRUCT_ZSTRUCT)
+  {
+    /* uncompress struct and read its token */
+    if(bstruct_readzstruct(bstr))
+      return TRUE;
+    if(bstruct_read(bstr,&data->token,1))
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR508: Unexpected end of file reading token in compressed struct.\n");
+      return TRUE;
+    }
+  }
   if(isinvalidtoken(data->token))
   {
     if(bstr->isout)
@@ -38,7 +50,10 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
     return TRUE;
   }
   if(data->token==BSTRUCT_END || data->token==BSTRUCT_ENDARRAY || data->token==BSTRUCT_ENDSTRUCT)
+  {
+    bstruct_closezstruct(bstr);
     return FALSE;
+  }
   if(data->token!=BSTRUCT_INDEXARRAY)
   {
     if(bstruct_hasname(data->token))
@@ -63,7 +78,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
        data->data.b=TRUE;
       return FALSE;
     case BSTRUCT_BYTE:
-      if(fread(&data->data.b,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&data->data.b,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -72,7 +87,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_USHORT:
-      if(freadushort(&data->data.us,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->data.us,1,sizeof(unsigned short)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -81,7 +96,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_SHORT:
-      if(freadshort(&data->data.s,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->data.s,1,sizeof(short)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -90,7 +105,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_INT:
-      if(freadint(&data->data.i,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->data.i,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -99,7 +114,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_FLOAT:
-      if(freadfloat(&data->data.f,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->data.f,1,sizeof(float)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -108,7 +123,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_DOUBLE:
-      if(freaddouble(&data->data.d,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->data.d,1,sizeof(double)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading %s '%s'.\n",
@@ -119,7 +134,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
     case BSTRUCT_STRING: case BSTRUCT_STRING1:
       if(data->token==BSTRUCT_STRING1)
       {
-        if(fread(&len,1,1,bstr->file)!=1)
+        if(bstruct_read(bstr,&len,1))
         {
           if(bstr->isout)
             fprintf(stderr,"ERROR508: Unexpected end of file reading string length of '%s'.\n",
@@ -130,7 +145,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       else
       {
-        if(freadint(&string_length,1,bstr->swap,bstr->file)!=1)
+        if(bstruct_readvalues(bstr,&string_length,1,sizeof(int)))
         {
           if(bstr->isout)
             fprintf(stderr,"ERROR508: Unexpected end of file reading string length of '%s'.\n",
@@ -151,7 +166,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
         printallocerr("string");
         return TRUE;
       }
-      if(fread(data->data.string,1,string_length,bstr->file)!=string_length)
+      if(bstruct_read(bstr,data->data.string,string_length))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading string '%s' of size %d.\n",
@@ -163,7 +178,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       data->data.string[string_length]='\0';
       return FALSE;
     case BSTRUCT_BEGINARRAY1:
-      if(fread(&len,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&len,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading array size of '%s'.\n",
@@ -173,7 +188,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       data->size=len;
       return FALSE;
     case BSTRUCT_BEGINARRAY:
-      if(freadint(&data->size,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->size,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading array size of '%s'.\n",
@@ -189,7 +204,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
       }
       return FALSE;
     case BSTRUCT_INDEXARRAY:
-      if(freadint(&data->size,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&data->size,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading size of index array.\n");
@@ -208,7 +223,7 @@ Bool bstruct_readdata(Bstruct bstr,      /**< pointer to restart file */
         printallocerr("index");
         return TRUE;
       }
-      if(freadlong(data->data.index,data->size,bstr->swap,bstr->file)!=data->size)
+      if(bstruct_readvalues(bstr,data->data.index,data->size,sizeof(long long)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading index array of size %d.\n",
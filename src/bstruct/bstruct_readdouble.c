@@ -39,7 +39,7 @@ Bool bstruct_readdouble(Bstruct bstr,     /**< pointer to restart file */
               getname(name),bstruct_typenames[token]);
     return TRUE;
   }
-  if(freaddouble(value,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,value,1,sizeof(double)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading double '%s'.\n",
@@ -21,7 +21,7 @@ Bool bstruct_readendarray(Bstruct bstr,    /**< pointer to restart file */
                          )                 /** \return TRUE on error */
 {
   Byte token;
-  if(fread(&token,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,&token,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading token for endarray of '%s'.\n",
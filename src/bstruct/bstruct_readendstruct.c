@@ -25,7 +25,7 @@ Bool bstruct_readendstruct(Bstruct bstr,    /**< pointer to restart file */
   int i;
   Id id;
   Byte token;
-  if(fread(&token,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,&token,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading token for endstruct of '%s'.\n",
@@ -78,7 +78,7 @@ Bool bstruct_readendstruct(Bstruct bstr,    /**< pointer to restart file */
       }
       if(bstruct_skipdata(bstr,token))
         return TRUE;
-      if(fread(&token,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&token,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading token for endstruct of '%s'.\n",
@@ -150,5 +150,6 @@ Bool bstruct_readendstruct(Bstruct bstr,    /**< pointer to restart file */
       fprintf(stderr,"ERROR516: Too many endstructs found.\n");
     return TRUE;
   }
+  bstruct_closezstruct(bstr);
   return FALSE;
 } /* of 'bstruct_readendstruct' */
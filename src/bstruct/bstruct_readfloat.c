@@ -40,7 +40,7 @@ Bool bstruct_readfloat(Bstruct bstr,     /**< pointer to restart file */
               getname(name),bstruct_typenames[token]);
     return TRUE;
   }
-  if(freadfloat(value,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,value,1,sizeof(float)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading float '%s'.\n",
@@ -25,12 +25,12 @@ Bool bstruct_readid(Bstruct bstr, /**< pointer to restart file */
   Byte id1;
   if((token & 64)==64) /* bit 7 set, id is of type unsigned short */
   {
-    if(freadushort(id,1,bstr->swap,bstr->file)!=1)
+    if(bstruct_readvalues(bstr,id,1,sizeof(unsigned short)))
       return TRUE;
   }
   else
   {
-    if(fread(&id1,1,1,bstr->file)!=1)
+    if(bstruct_read(bstr,&id1,1))
       return TRUE;
     *id=id1;
   }
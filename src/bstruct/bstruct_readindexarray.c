@@ -32,7 +32,7 @@ Bool bstruct_readindexarray(Bstruct bstr,    /**< pointer to restart file */
               bstruct_typenames[token & 63]);
     return TRUE;
   }
-  if(freadint(&n,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,&n,1,sizeof(int)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR512: Cannot read length of index array.\n");
@@ -44,7 +44,7 @@ Bool bstruct_readindexarray(Bstruct bstr,    /**< pointer to restart file */
       fprintf(stderr,"ERROR510: Size of index array=%d not %d.\n",n,size);
     return TRUE;
   }
-  if(freadlong(data,size,bstr->swap,bstr->file)!=size)
+  if(bstruct_readvalues(bstr,data,size,sizeof(long long)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading index array of size %d.\n",
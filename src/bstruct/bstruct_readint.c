@@ -35,7 +35,7 @@ Bool bstruct_readint(Bstruct bstr,     /**< pointer to restart file */
       *value=0;
       return FALSE;
     case BSTRUCT_BYTE:
-      if(fread(&token,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&token,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading int '%s'.\n",
@@ -45,7 +45,7 @@ Bool bstruct_readint(Bstruct bstr,     /**< pointer to restart file */
       *value=token;
       return FALSE;
     case BSTRUCT_SHORT:
-      if(freadshort(&s,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&s,1,sizeof(short)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading int '%s'.\n",
@@ -55,7 +55,7 @@ Bool bstruct_readint(Bstruct bstr,     /**< pointer to restart file */
       *value=s;
       return FALSE;
     case BSTRUCT_USHORT:
-      if(freadushort(&us,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&us,1,sizeof(unsigned short)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading int '%s'.\n",
@@ -65,7 +65,7 @@ Bool bstruct_readint(Bstruct bstr,     /**< pointer to restart file */
       *value=us;
       return FALSE;
     case BSTRUCT_INT:
-      if(freadint(value,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,value,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading int '%s'.\n",
@@ -39,7 +39,7 @@ Bool bstruct_readreal(Bstruct bstr,     /**< pointer to restart file */
               getname(name),bstruct_typenames[token]);
     return TRUE;
   }
-  if(freadreal(value,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,value,1,sizeof(Real)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR508: Unexpected end of file reading double '%s'.\n",
@@ -33,7 +33,7 @@ Bool bstruct_readshort(Bstruct bstr,     /**< pointer to restart file */
       *value=0;
       return FALSE;
     case BSTRUCT_BYTE:
-      if(fread(&token,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&token,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading short '%s'.\n",
@@ -43,7 +43,7 @@ Bool bstruct_readshort(Bstruct bstr,     /**< pointer to restart file */
       *value=token;
       return FALSE;
     case BSTRUCT_SHORT:
-      if(freadshort(value,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,value,1,sizeof(short)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading short '%s'.\n",
@@ -32,7 +32,7 @@ char *bstruct_readstring(Bstruct bstr,    /**< pointer to restart file */
   switch(token)
   {
     case BSTRUCT_STRING:
-      if(freadint(&len,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&len,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR512: Cannot read string length of '%s'.\n",getname(name));
@@ -47,7 +47,7 @@ char *bstruct_readstring(Bstruct bstr,    /**< pointer to restart file */
       }
       break;
     case BSTRUCT_STRING1:
-      if(fread(&len1,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&len1,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR512: Cannot read string length of '%s'.\n",getname(name));
@@ -67,7 +67,7 @@ char *bstruct_readstring(Bstruct bstr,    /**< pointer to restart file */
     printallocerr("string");
     return NULL;
   }
-  if(fread(s,1,len,bstr->file)!=len)
+  if(bstruct_read(bstr,s,len))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR512: Cannot read string '%s' of length %d.\n",
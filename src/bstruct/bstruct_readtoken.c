@@ -32,13 +32,25 @@ Bool bstruct_readtoken(Bstruct bstr,     /**< pointer to restart file */
      token & 64 (=0b01000000)  gets bit 7
      token & 63 (=0b00111111)  gets bit 1..6 for type
    */
-  if(fread(token_read,1,1,bstr->file)!=1)
+  if(bstruct_read(bstr,token_read,1))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR501: Cannot read '%s': %s.\n",
               name,strerror(errno));
     return TRUE;
   }
+  if(*token_read==BSTRUCT_ZSTRUCT)
+  {
+    /* uncompress struct and read its token */
+    if(bstruct_readzstruct(bstr))
+      return TRUE;
+    if(bstruct_read(bstr,token_read,1))
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR501: Cannot read '%s' in compressed struct.\n",getname(name));
+      return TRUE;
+    }
+  }
   if(isinvalidtoken(*token_read))
   {
     if(bstr->isout)
@@ -0,0 +1,45 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**  b  s  t  r  u  c  t  _  r  e  a  d  v  a  l  u  e  s  .  c                    \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_readvalues(Bstruct bstr, /**< pointer to restart file */
+                        void *data,   /**< [out] array of values read */
+                        size_t n,     /**< number of values */
+                        size_t size   /**< size of one value in bytes (1,2,4 or 8) */
+                       )              /** \return TRUE on error */
+{
+  /* Function reads array of values and changes byte order if necessary */
+  char *ptr,h;
+  size_t i,j;
+  if(bstruct_read(bstr,data,n*size))
+    return TRUE;
+  if(bstr->swap && size>1)
+  {
+    ptr=data;
+    for(i=0;i<n;i++)
+    {
+      for(j=0;j<size/2;j++)
+      {
+        h=ptr[j];
+        ptr[j]=ptr[size-1-j];
+        ptr[size-1-j]=h;
+      }
+      ptr+=size;
+    }
+  }
+  return FALSE;
+} /* of 'bstruct_readvalues' */
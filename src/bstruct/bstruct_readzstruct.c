@@ -0,0 +1,108 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/** b  s  t  r  u  c  t  _  r  e  a  d  z  s  t  r  u  c  t  .  c                  \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+Bool bstruct_readzstruct(Bstruct bstr /**< pointer to restart file */
+                        )             /** \return TRUE on error */
+{
+  /* Function is called after token BSTRUCT_ZSTRUCT has been read. Compressed
+   * struct is uncompressed into memory and subsequent reads are done from
+   * memory until the struct has been read completely */
+#ifdef USE_ZLIB
+  const char *src;
+  char *data,*zbuf;
+  uLongf size;
+  int len[2];
+  if(bstr->iszstruct)
+  {
+    if(bstr->isout)
+      fprintf(stderr,"ERROR531: Compressed structs cannot be nested.\n");
+    return TRUE;
+  }
+  if(bstruct_readvalues(bstr,len,2,sizeof(int)) || len[0]<=0 || len[1]<=0)
+  {
+    if(bstr->isout)
+      fprintf(stderr,"ERROR508: Unexpected end of file reading size of compressed struct.\n");
+    return TRUE;
+  }
+  if(bstr->zbufsize<(size_t)len[1])
+  {
+    zbuf=realloc(bstr->zbuf,len[1]);
+    if(zbuf==NULL)
+    {
+      printallocerr("zbuf");
+      return TRUE;
+    }
+    bstr->zbuf=zbuf;
+    bstr->zbufsize=len[1];
+  }
+  data=NULL;
+  if(bstr->mem!=NULL)
+  {
+    /* compressed data are already in memory */
+    src=bstr->mem+bstr->pos;
+    if(bstruct_seek(bstr,len[0],SEEK_CUR))
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR508: Unexpected end of file reading compressed struct.\n");
+      return TRUE;
+    }
+  }
+  else
+  {
+    data=malloc(len[0]);
+    if(data==NULL)
+    {
+      printallocerr("data");
+      return TRUE;
+    }
+    if(bstruct_read(bstr,data,len[0]))
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR508: Unexpected end of file reading compressed struct.\n");
+      free(data);
+      return TRUE;
+    }
+    src=data;
+  }
+  size=len[1];
+  if(uncompress((Bytef *)bstr->zbuf,&size,(const Bytef *)src,len[0])!=Z_OK || size!=(uLongf)len[1])
+  {
+    if(bstr->isout)
+      fprintf(stderr,"ERROR532: Cannot uncompress struct.\n");
+    free(data);
+    return TRUE;
+  }
+  free(data);
+  /* save read position and continue reading from uncompressed data */
+  bstr->outer.mem=bstr->mem;
+  bstr->outer.memsize=bstr->memsize;
+  bstr->outer.pos=bstr->pos;
+  bstr->mem=bstr->zbuf;
+  bstr->memsize=len[1];
+  bstr->pos=0;
+  bstr->iszstruct=TRUE;
+  return FALSE;
+#else
+  if(bstr->isout)
+    fprintf(stderr,"ERROR533: Compressed struct found, but zlib support not compiled in.\n");
+  return TRUE;
+#endif
+} /* of 'bstruct_readzstruct' */
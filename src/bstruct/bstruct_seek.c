@@ -0,0 +1,35 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**           b  s  t  r  u  c  t  _  s  e  e  k  .  c                             \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_seek(Bstruct bstr,     /**< pointer to restart file */
+                  long long offset, /**< offset in bytes */
+                  int whence        /**< SEEK_SET or SEEK_CUR */
+                 )                  /** \return TRUE on error */
+{
+  /* Function sets read position in memory or in file */
+  if(bstr->mem!=NULL)
+  {
+    if(whence==SEEK_CUR)
+      offset+=bstr->pos;
+    if(offset<0 || offset>(long long)bstr->memsize)
+      return TRUE;
+    bstr->pos=offset;
+    return FALSE;
+  }
+  return fseek(bstr->file,offset,whence)!=0;
+} /* of 'bstruct_seek' */
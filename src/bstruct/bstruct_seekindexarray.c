@@ -33,7 +33,7 @@ Bool bstruct_seekindexarray(Bstruct bstr, /**< pointer to restart file */
               bstruct_typenames[token & 63]);
     return TRUE;
   }
-  if(freadint(&n,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,&n,1,sizeof(int)))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR512: Cannot read length of index array.\n");
@@ -45,12 +45,12 @@ Bool bstruct_seekindexarray(Bstruct bstr, /**< pointer to restart file */
       fprintf(stderr,"ERROR510: Size of index array=%d not %d.\n",n,size);
     return TRUE;
   }
-  if(fseek(bstr->file,sizeof(long long)*index,SEEK_CUR))
+  if(bstruct_seek(bstr,sizeof(long long)*index,SEEK_CUR))
   {
     fprintf(stderr,"ERROR511: Cannot skip to %d in index array.\n",index);
     return TRUE;
   }
-  if(freadlong(&pos,1,bstr->swap,bstr->file)!=1)
+  if(bstruct_readvalues(bstr,&pos,1,sizeof(long long)))
   {
     fprintf(stderr,"ERROR512: Cannot read file index for %d.\n",index);
     return TRUE;
@@ -60,7 +60,7 @@ Bool bstruct_seekindexarray(Bstruct bstr, /**< pointer to restart file */
     fprintf(stderr,"ERROR512: Invalid position in array.\n");
     return TRUE;
   }
-  if(fseek(bstr->file,pos,SEEK_SET))
+  if(bstruct_seek(bstr,pos,SEEK_SET))
   {
     fprintf(stderr,"ERROR511: Cannot skip to file position %lld.\n",pos);
     return TRUE;
@@ -0,0 +1,31 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/** b  s  t  r  u  c  t  _  s  e  t  c  o  m  p  r  e  s  s  .  c                  \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_setcompress(Bstruct bstruct, /**< pointer to restart file */
+                         int level        /**< compression level (0-9), 0 for no compression */
+                        )                 /** \return TRUE if compression is not supported */
+{
+  /* Function sets compression level of structs written by bstruct_writebeginzstruct() */
+#ifdef USE_ZLIB
+  bstruct->compress=level;
+  return FALSE;
+#else
+  bstruct->compress=0;
+  return level>0;
+#endif
+} /* of 'bstruct_setcompress' */
@@ -21,7 +21,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
                      )              /** \return TRUE on error */
 {
   /* Function skips one object in restart file */
-  int string_len;
+  int string_len,len2[2];
   Byte len,b;
   if(isinvalidtoken(token))
   {
@@ -35,7 +35,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
       do
       {
         /* skip whole struct */
-        if(fread(&b,1,1,bstr->file)!=1)
+        if(bstruct_read(bstr,&b,1))
         {
           if(bstr->isout)
             fprintf(stderr,"ERROR508: Unexpected end of file reading token in struct.\n");
@@ -67,7 +67,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
           /* skip object name */
           if((b & 128)==128) /* top bit in token set, object name stored in next byte or short */
           {
-            if(fseek(bstr->file,((b & 64)==64) ? sizeof(short) : 1,SEEK_CUR))
+            if(bstruct_seek(bstr,((b & 64)==64) ? sizeof(short) : 1,SEEK_CUR))
             {
               if(bstr->isout)
                 fprintf(stderr,"ERROR507: Unexpected end of file skipping object name.\n");
@@ -82,7 +82,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
       break;
     case BSTRUCT_BEGINARRAY: case BSTRUCT_BEGINARRAY1: /* object is an array */
       /* skip array size */
-      if(fseek(bstr->file,((token & 63)==BSTRUCT_BEGINARRAY1) ? 1 : sizeof(int),SEEK_CUR))
+      if(bstruct_seek(bstr,((token & 63)==BSTRUCT_BEGINARRAY1) ? 1 : sizeof(int),SEEK_CUR))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR507: Unexpected end of file skipping array length.\n");
@@ -91,7 +91,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
       /* skip whole array */
       do
       {
-        if(fread(&b,1,1,bstr->file)!=1)
+        if(bstruct_read(bstr,&b,1))
         {
           if(bstr->isout)
             fprintf(stderr,"ERROR508: Unexpected end of file reading token in array.\n");
@@ -117,13 +117,13 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
         }
         if(b==BSTRUCT_INDEXARRAY)
         {
-          if(freadint(&string_len,1,bstr->swap,bstr->file)!=1)
+          if(bstruct_readvalues(bstr,&string_len,1,sizeof(int)))
           {
             if(bstr->isout)
               fprintf(stderr,"ERROR508: Unexpected end of file reading index array length.\n");
             return TRUE;
           }
-          if(fseek(bstr->file,sizeof(long long)*string_len,SEEK_CUR))
+          if(bstruct_seek(bstr,sizeof(long long)*string_len,SEEK_CUR))
           {
             if(bstr->isout)
               fprintf(stderr,"ERROR507: Unexpected end of file skipping index array of size %d.\n",
@@ -136,7 +136,7 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
           /* skip object name */
           if((b & 128)==128) /* top bit in token set, object name stored in next byte or short */
           {
-            if(fseek(bstr->file,((b & 64)==64) ? sizeof(short) : 1,SEEK_CUR))
+            if(bstruct_seek(bstr,((b & 64)==64) ? sizeof(short) : 1,SEEK_CUR))
             {
               if(bstr->isout)
                 fprintf(stderr,"ERROR507: Unexpected end of file skipping object name.\n");
@@ -150,13 +150,13 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
       } while(b!=BSTRUCT_ENDARRAY);
       break;
     case BSTRUCT_STRING:
-      if(freadint(&string_len,1,bstr->swap,bstr->file)!=1)
+      if(bstruct_readvalues(bstr,&string_len,1,sizeof(int)))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading string length.\n");
         return TRUE;
       }
-      if(fseek(bstr->file,string_len,SEEK_CUR))
+      if(bstruct_seek(bstr,string_len,SEEK_CUR))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR507: Unexpected end of file skipping string of length %d.\n",
@@ -165,13 +165,13 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
       }
       break;
     case BSTRUCT_STRING1:
-      if(fread(&len,1,1,bstr->file)!=1)
+      if(bstruct_read(bstr,&len,1))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR508: Unexpected end of file reading string length.\n");
         return TRUE;
       }
-      if(fseek(bstr->file,len,SEEK_CUR))
+      if(bstruct_seek(bstr,len,SEEK_CUR))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR507: Unexpected end of file skipping string of length %d.\n",
@@ -179,9 +179,25 @@ Bool bstruct_skipdata(Bstruct bstr, /**< pointer to restart file */
         return TRUE;
       }
       break;
+    case BSTRUCT_ZSTRUCT:
+      if(bstruct_readvalues(bstr,len2,2,sizeof(int)))
+      {
+        if(bstr->isout)
+          fprintf(stderr,"ERROR508: Unexpected end of file reading size of compressed struct.\n");
+        return TRUE;
+      }
+      /* skip compressed data */
+      if(bstruct_seek(bstr,len2[0],SEEK_CUR))
+      {
+        if(bstr->isout)
+          fprintf(stderr,"ERROR507: Unexpected end of file skipping compressed struct of size %d.\n",
+                  len2[0]);
+        return TRUE;
+      }
+      break;
     default:
       /* skip object data */
-      if(fseek(bstr->file,bstruct_typesizes[token & 63],SEEK_CUR))
+      if(bstruct_seek(bstr,bstruct_typesizes[token & 63],SEEK_CUR))
       {
         if(bstr->isout)
           fprintf(stderr,"ERROR507: Unexpected end of file skipping %s.\n",
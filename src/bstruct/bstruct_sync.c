@@ -18,6 +18,9 @@
 
 void bstruct_sync(Bstruct bstr)
 {
+  if(bstr->file==NULL)
+    return;
+  bstruct_flush(bstr);
   fflush(bstr->file);
 #ifndef _WIN32
   fsync(fileno(bstr->file));
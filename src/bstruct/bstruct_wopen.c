@@ -31,6 +31,7 @@ Bstruct bstruct_wopen(const char *filename, /**< filename of restart file to cre
    *     15|11TOKEN|id1|id2|                     # type with word id           (3 bytes)
    *     17|10TOKEN|id|d1|d2...|dn|              # type with byte id and data  (2 bytes + sizeof(data))
    *   19+n|...
+   *      q|BSTRUCT_ZSTRUCT|c|n|z1|...|zc|       # compressed struct           (9 + c bytes)
    *    p-1|BSTRUCT_END|                         # end token                   (1 byte)
    *      p|size1|size2|size3|size4|             # size of name table          (4 bytes)
    *    p+4|n|s1|s2|...|sn|                      # name                        (1+ name length bytes)
@@ -52,6 +53,7 @@ Bstruct bstruct_wopen(const char *filename, /**< filename of restart file to cre
   bstruct->isout=isout;
   /* Initialize name stack */
   bstruct->level=1;
+  bstruct->namepos=0;
   bstruct->namestack[0].type=BSTRUCT_BEGINSTRUCT;
   bstruct->namestack[0].nr=0;
   bstruct->namestack[0].size=0;
@@ -60,6 +62,21 @@ Bstruct bstruct_wopen(const char *filename, /**< filename of restart file to cre
   bstruct->names=NULL;
   bstruct->names2=NULL;
   bstruct->count=0;
+  bstruct->buf=NULL;
+  bstruct->block=NULL;
+  bstruct->blocklen=bstruct->blocksize=0;
+  bstruct->mem=NULL;
+  bstruct->memsize=bstruct->pos=0;
+  bstruct->ismapped=FALSE;
+  bstruct->compress=0;
+  bstruct->iszstruct=FALSE;
+  bstruct->zbuf=NULL;
+  bstruct->zbufsize=0;
+  for(i=0;i<BSTRUCT_NAMECACHE;i++)
+  {
+    bstruct->namecache[i].name=NULL;
+    bstruct->namecache[i].key=NULL;
+  }
   bstruct->file=fopen(filename,(append) ? "r+b" : "wb");
   if(bstruct->file==NULL)
   {
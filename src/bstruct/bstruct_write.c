@@ -0,0 +1,52 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**         b  s  t  r  u  c  t  _  w  r  i  t  e  .  c                            \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_write(Bstruct bstr,     /**< pointer to restart file */
+                   const void *data, /**< data to write */
+                   size_t size       /**< size of data in bytes */
+                  )                  /** \return TRUE on error */
+{
+  /* Function appends data to block in memory instead of calling fwrite()
+   * for every item. Block is written to file if BSTRUCT_BLOCKSIZE is
+   * exceeded, for restart objects in memory and for structs to be
+   * compressed block grows */
+  char *block;
+  size_t blocksize;
+  if(bstr->file!=NULL && !bstr->iszstruct && bstr->blocklen+size>BSTRUCT_BLOCKSIZE)
+  {
+    if(bstruct_flush(bstr))
+      return TRUE;
+  }
+  if(bstr->blocklen+size>bstr->blocksize)
+  {
+    blocksize=max(2*bstr->blocksize,bstr->blocklen+size);
+    if(bstr->file!=NULL)
+      blocksize=max(blocksize,BSTRUCT_BLOCKSIZE);
+    block=realloc(bstr->block,blocksize);
+    if(block==NULL)
+    {
+      printallocerr("block");
+      return TRUE;
+    }
+    bstr->block=block;
+    bstr->blocksize=blocksize;
+  }
+  memcpy(bstr->block+bstr->blocklen,data,size);
+  bstr->blocklen+=size;
+  return FALSE;
+} /* of 'bstruct_write' */
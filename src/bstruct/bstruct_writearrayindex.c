@@ -23,8 +23,26 @@ Bool bstruct_writearrayindex(Bstruct bstr,            /**< pointer to restart fi
                              int size                 /**< size of index vector */
                             )                         /** \return TRUE on error */
 {
+  long long start; /* file position of first byte in block */
   Bool rc;
-  if(fseek(bstr->file,filepos+sizeof(long long)*offset,SEEK_SET))
+  filepos+=sizeof(long long)*offset;
+  start=(bstr->file==NULL) ? 0 : ftell(bstr->file);
+  if(filepos>=start)
+  {
+    /* index vector is still in block in memory */
+    if(filepos-start+(long long)(sizeof(long long)*size)>(long long)bstr->blocklen)
+    {
+      if(bstr->isout)
+        fprintf(stderr,"ERROR519: Cannot skip to position %d in index array.\n",offset);
+      return TRUE;
+    }
+    memcpy(bstr->block+(filepos-start),index,sizeof(long long)*size);
+    return FALSE;
+  }
+  /* index vector has already been written to file */
+  if(bstruct_flush(bstr))
+    return TRUE;
+  if(fseek(bstr->file,filepos,SEEK_SET))
   {
     if(bstr->isout)
       fprintf(stderr,"ERROR519: Cannot skip to position %d in index array.\n",offset);
@@ -41,8 +41,8 @@ Bool bstruct_writebeginarray(Bstruct bstr,     /**< pointer to restart file */
   if(size<=UCHAR_MAX)
   {
     b=size;
-    return fwrite(&b,1,1,bstr->file)!=1;
+    return bstruct_write(bstr,&b,1);
   }
   else
-    return fwrite(&size,sizeof(size),1,bstr->file)!=1;
+    return bstruct_write(bstr,&size,sizeof(size));
 } /* of 'bstruct_writebeginarray' */
@@ -29,12 +29,12 @@ Bool bstruct_writebeginindexarray(Bstruct bstr,       /**< pointer to restart fi
   if(bstruct_writebeginarray(bstr,name,size))
     return TRUE;
   token=BSTRUCT_INDEXARRAY;
-  fwrite(&token,1,1,bstr->file);
-  if(fwrite(&size,sizeof(size),1,bstr->file)!=1)
+  bstruct_write(bstr,&token,1);
+  if(bstruct_write(bstr,&size,sizeof(size)))
     return TRUE;
-  *filepos=ftell(bstr->file);
+  *filepos=bstruct_tell(bstr);
   for(i=0;i<size;i++)
-    if(fwrite(&zero,sizeof(zero),1,bstr->file)!=1)
+    if(bstruct_write(bstr,&zero,sizeof(zero)))
       return TRUE;
   return FALSE;
 } /* of 'bstruct_writebeginindexarray' */
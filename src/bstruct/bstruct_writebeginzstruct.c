@@ -0,0 +1,37 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/** b  s  t  r  u  c  t  _  w  r  i  t  e  b  e  g  i  n  z  s  t  r  u  c  t  .  c\n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+
+Bool bstruct_writebeginzstruct(Bstruct bstr /**< pointer to restart file */
+                              )             /** \return TRUE on error */
+{
+  /* Function adds a new level of unnamed struct in array. If compression
+   * is enabled, data of struct are collected in the block and compressed
+   * by bstruct_writeendzstruct() */
+  if(bstr->compress>0)
+  {
+    if(bstr->iszstruct)
+    {
+      fprintf(stderr,"ERROR531: Compressed structs cannot be nested.\n");
+      bstruct_printnamestack(bstr);
+      return TRUE;
+    }
+    bstr->iszstruct=TRUE;
+    bstr->zstart=bstr->blocklen;
+  }
+  return bstruct_writebeginstruct(bstr,NULL);
+} /* of 'bstruct_writebeginzstruct' */
@@ -55,10 +55,10 @@ Bool bstruct_writedata(Bstruct bstr,            /**< pointer to restart file */
     case BSTRUCT_NULL:
       return bstruct_writenull(bstr,data->name);
     case BSTRUCT_INDEXARRAY:
-      fwrite(&data->token,1,1,bstr->file);
-      if(fwrite(&data->size,sizeof(data->size),1,bstr->file)!=1)
+      bstruct_write(bstr,&data->token,1);
+      if(bstruct_write(bstr,&data->size,sizeof(data->size)))
         return TRUE;
-      return fwrite(data->data.index,sizeof(long long),data->size,bstr->file)!=data->size;
+      return bstruct_write(bstr,data->data.index,sizeof(long long)*data->size);
     default:
       return TRUE;
   }
@@ -37,5 +37,5 @@ Bool bstruct_writeendstruct(Bstruct bstr /**< pointer to restart file */
   free(bstr->namestack[bstr->level-1].name);
   bstr->level--;
   token=BSTRUCT_ENDSTRUCT;
-  return fwrite(&token,1,1,bstr->file)!=1;
+  return bstruct_write(bstr,&token,1);
 } /* of 'bstruct_writeendstruct' */
@@ -0,0 +1,71 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/** b  s  t  r  u  c  t  _  w  r  i  t  e  e  n  d  z  s  t  r  u  c  t  .  c      \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions for reading/writing JSON-like objects from binary file           \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "bstruct_intern.h"
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+Bool bstruct_writeendzstruct(Bstruct bstr /**< pointer to restart file */
+                            )             /** \return TRUE on error */
+{
+  /* Function ends struct started by bstruct_writebeginzstruct() and
+   * replaces its data in the block by the compressed data:
+   * |BSTRUCT_ZSTRUCT|compressed size (int)|size (int)|compressed data|
+   */
+#ifdef USE_ZLIB
+  char *zbuf;
+  uLongf zsize;
+  int size[2];
+  Byte token;
+#endif
+  if(bstruct_writeendstruct(bstr))
+    return TRUE;
+  if(!bstr->iszstruct)
+    return FALSE;
+  bstr->iszstruct=FALSE;
+#ifdef USE_ZLIB
+  zsize=compressBound(bstr->blocklen-bstr->zstart);
+  if(zsize>bstr->zbufsize)
+  {
+    zbuf=realloc(bstr->zbuf,zsize);
+    if(zbuf==NULL)
+    {
+      printallocerr("zbuf");
+      return TRUE;
+    }
+    bstr->zbuf=zbuf;
+    bstr->zbufsize=zsize;
+  }
+  if(compress2((Bytef *)bstr->zbuf,&zsize,(const Bytef *)bstr->block+bstr->zstart,
+               bstr->blocklen-bstr->zstart,bstr->compress)!=Z_OK)
+  {
+    fprintf(stderr,"ERROR532: Cannot compress struct.\n");
+    return TRUE;
+  }
+  if(zsize+sizeof(Byte)+sizeof(size)>=bstr->blocklen-bstr->zstart)
+    return FALSE; /* compression does not reduce size, keep uncompressed struct */
+  size[0]=zsize;
+  size[1]=bstr->blocklen-bstr->zstart;
+  bstr->blocklen=bstr->zstart;
+  token=BSTRUCT_ZSTRUCT;
+  bstruct_write(bstr,&token,1);
+  bstruct_write(bstr,size,sizeof(size));
+  return bstruct_write(bstr,bstr->zbuf,zsize);
+#else
+  return FALSE;
+#endif
+} /* of 'bstruct_writeendzstruct' */
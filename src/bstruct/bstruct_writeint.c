@@ -40,15 +40,15 @@ Bool bstruct_writeint(Bstruct bstr,     /**< pointer to restart file */
   {
     case BSTRUCT_BYTE:
       token=value;
-      return fwrite(&token,1,1,bstr->file)!=1;
+      return bstruct_write(bstr,&token,1);
     case BSTRUCT_USHORT:
       us=value;
-      return fwrite(&us,sizeof(us),1,bstr->file)!=1;
+      return bstruct_write(bstr,&us,sizeof(us));
     case BSTRUCT_SHORT:
       s=value;
-      return fwrite(&s,sizeof(short),1,bstr->file)!=1;
+      return bstruct_write(bstr,&s,sizeof(short));
     case BSTRUCT_INT:
-      return fwrite(&value,sizeof(value),1,bstr->file)!=1;
+      return bstruct_write(bstr,&value,sizeof(value));
     default:
       break;
   }
@@ -22,10 +22,11 @@ Bool bstruct_writename(Bstruct bstr,    /**< pointer to restart file */
                       )                 /** \return TRUE on error */
 {
   /* Function writes token and id of name of object into restart file */
-  int len,count;
+  int len,count,slot;
   Id *id;
   Byte id1;
   char *s;
+  Hashitem item;
   bstr->namestack[bstr->level-1].nr++;
   len=(name==NULL) ? 0 : strlen(name);
   if(len==0)
@@ -37,7 +38,7 @@ Bool bstruct_writename(Bstruct bstr,    /**< pointer to restart file */
               getname(bstr->namestack[bstr->level-1].name));
       bstruct_printnamestack(bstr);
     }
-    return fwrite(&token,1,1,bstr->file)!=1;
+    return bstruct_write(bstr,&token,1);
   }
   else
   {
@@ -55,46 +56,57 @@ Bool bstruct_writename(Bstruct bstr,    /**< pointer to restart file */
     return TRUE;
   }
   token|=128; /* set top bit in token */
-  /* Look in hash table whether name has already been used */
-  id=gethashitem(bstr->hash,name);
-  if(id==NULL)
+  /* names are mostly string constants, look first in cache indexed by address of name */
+  slot=((size_t)name>>3) & (BSTRUCT_NAMECACHE-1);
+  if(bstr->namecache[slot].name!=name || strcmp(bstr->namecache[slot].key,name))
   {
-    /* name not found in hash, add name and new id to hash table */
-    count=gethashcount(bstr->hash);
-    if(count==USHRT_MAX+1)
+    /* Look in hash table whether name has already been used */
+    if(!findhashitem(bstr->hash,name,&item))
     {
-      fprintf(stderr,"ERROR518: Maximum number of names=%d in table reached.\n",USHRT_MAX+1);
-      return TRUE;
-    }
-    id=new(Id);
-    if(id==NULL)
-    {
-      printallocerr("id");
-      return TRUE;
-    }
-    *id=count;
-    s=strdup(name);
-    if(s==NULL)
-    {
-      free(id);
-      printallocerr("name");
-      return TRUE;
-    }
-    if(addhashitem(bstr->hash,s,id)==0)
-    {
-      free(id);
-      free(s);
-      printallocerr("hash");
-      return TRUE;
+      /* name not found in hash, add name and new id to hash table */
+      count=gethashcount(bstr->hash);
+      if(count==USHRT_MAX+1)
+      {
+        fprintf(stderr,"ERROR518: Maximum number of names=%d in table reached.\n",USHRT_MAX+1);
+        return TRUE;
+      }
+      id=new(Id);
+      if(id==NULL)
+      {
+        printallocerr("id");
+        return TRUE;
+      }
+      *id=count;
+      s=strdup(name);
+      if(s==NULL)
+      {
+        free(id);
+        printallocerr("name");
+        return TRUE;
+      }
+      if(addhashitem(bstr->hash,s,id)==0)
+      {
+        free(id);
+        free(s);
+        printallocerr("hash");
+        return TRUE;
+      }
+      item.key=s;
+      item.data=id;
     }
+    /* store name in hash in cache, name may be changed by caller */
+    bstr->namecache[slot].key=item.key;
+    bstr->namecache[slot].name=name;
+    bstr->namecache[slot].id=*((Id *)item.data);
   }
+  id=&bstr->namecache[slot].id;
   if(*id>UCHAR_MAX)
   {
     token|=64; /* set bit 7 in token */
-    fwrite(&token,1,1,bstr->file);
-    return fwrite(id,sizeof(Id),1,bstr->file)!=1;
+    bstruct_write(bstr,&token,1);
+    return bstruct_write(bstr,id,sizeof(Id));
   }
   id1=*id;
-  fwrite(&token,1,1,bstr->file);
-  return fwrite(&id1,1,1,bstr->file)!=1;
+  bstruct_write(bstr,&token,1);
+  return bstruct_write(bstr,&id1,1);
 } /* of 'bstruct_writename' */
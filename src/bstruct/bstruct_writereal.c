@@ -30,6 +30,6 @@ Bool bstruct_writereal(Bstruct bstr,     /**< pointer to restart file */
   if(bstruct_writename(bstr,token,name))
     return TRUE;
   if(token!=BSTRUCT_FZERO)
-    rc=fwrite(&value,sizeof(value),1,bstr->file)!=1;
+    rc=bstruct_write(bstr,&value,sizeof(value));
   return rc;
 } /* of 'bstruct_writereal' */
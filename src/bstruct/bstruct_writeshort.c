@@ -34,9 +34,9 @@ Bool bstruct_writeshort(Bstruct bstr,     /**< pointer to restart file */
   {
     case BSTRUCT_BYTE:
       token=value;
-      return fwrite(&token,1,1,bstr->file)!=1;
+      return bstruct_write(bstr,&token,1);
     case BSTRUCT_SHORT:
-      return fwrite(&value,sizeof(value),1,bstr->file)!=1;
+      return bstruct_write(bstr,&value,sizeof(value));
     default:
       break;
   }
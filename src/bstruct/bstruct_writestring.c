@@ -31,9 +31,9 @@ Bool bstruct_writestring(Bstruct bstr,     /**< pointer to restart file */
   if(len<=UCHAR_MAX)
   {
     b=len;
-    fwrite(&b,1,1,bstr->file);
+    bstruct_write(bstr,&b,1);
   }
   else
-    fwrite(&len,sizeof(len),1,bstr->file);
-  return fwrite(value,1,len,bstr->file)!=len;
+    bstruct_write(bstr,&len,sizeof(len));
+  return bstruct_write(bstr,value,len);
 } /* of 'bstruct_writestring' */
@@ -15,6 +15,9 @@
 /**************************************************************************************/
 
 #include "lpj.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 void closeclimatefile(Climatefile *file, /**< pointer to climate data file */
                       Bool isroot        /**< task is root task (TRUE/FALSE) */
@@ -26,6 +29,13 @@ void closeclimatefile(Climatefile *file, /**< pointer to climate data file */
       closeclimate_netcdf(file,isroot);
     else
     {
+#ifndef _WIN32
+      if(file->map!=NULL)
+      {
+        munmap(file->map,file->mapsize);
+        file->map=NULL;
+      }
+#endif
       fclose(file->file);
       file->isopen=FALSE;
     }
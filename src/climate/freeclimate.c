@@ -65,6 +65,7 @@ void freeclimate(Climate *climate, /**< pointer to climate data */
 {
   if(climate!=NULL)
   {
+    freereadahead(climate->readahead);
     closeclimatefile(&climate->file_temp,isroot);
     closeclimatefile(&climate->file_prec,isroot);
     closeclimatefile(&climate->file_tmax,isroot);
@@ -75,6 +75,15 @@ Bool readclimate(Climatefile *file,   /**< climate data file */
     }
     if(file->fmt==CDF)
       rc=readclimate_netcdf(file,data,grid,index,config);
+    else if(file->map!=NULL)
+    {
+      /* convert data directly from memory-mapped file */
+      if(index*file->size+file->offset+(long long)file->n*typesizes[file->datatype]>(long long)file->mapsize)
+        rc=TRUE;
+      else
+        rc=convertrealvec((Byte *)file->map+index*file->size+file->offset,
+                          data,intercept,slope,file->n,file->swap,file->datatype);
+    }
     else
     {
       if(fseek(file->file,index*file->size+file->offset,SEEK_SET))
@@ -87,6 +96,16 @@ Bool readclimate(Climatefile *file,   /**< climate data file */
   return iserror(rc,config);
 } /* of'readclimate' */
 
+static Bool readclimate2(Climate *climate,Climatefile *file,Real data[],const Cell grid[],
+                         int year,const Config *config)
+{
+  Bool rc;
+  /* use data of year already read and converted by readaheadclimate() */
+  if(getreadahead(climate->readahead,file,data,year,&rc))
+    return iserror(rc,config);
+  return readclimate(file,data,0,file->scalar,grid,year,1,config);
+} /* of 'readclimate2' */
+
 Bool getclimate(Climate *climate,    /**< pointer to climate data */
                 const Cell grid[],   /**< LPJ grid */
                 int data_index,
@@ -99,6 +118,8 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
   Bool rc, isclimate;
   int i,index;
 
+  /* climate files must not be accessed while readahead thread is running */
+  waitreadahead(climate->readahead);
   if (config->isanomaly)
   {
     if (config->delta_year>1)
@@ -110,7 +131,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     isclimate = TRUE;
   if (isclimate)
   {
-    if(readclimate(&climate->file_temp,climate->data[data_index].temp,0,climate->file_temp.scalar,grid,year, 1,config))
+    if(readclimate2(climate,&climate->file_temp,climate->data[data_index].temp,grid,year,config))
     {
       if(isroot(*config))
       {
@@ -121,7 +142,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
       }
       return TRUE;
     }
-    if(readclimate(&climate->file_prec,climate->data[data_index].prec,0,climate->file_prec.scalar,grid,year, 1,config))
+    if(readclimate2(climate,&climate->file_prec,climate->data[data_index].prec,grid,year,config))
     {
       if(isroot(*config))
       {
@@ -134,7 +155,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     }
     if(climate->data[0].tmax!=NULL)
     {
-      if(readclimate(&climate->file_tmax,climate->data[data_index].tmax,0,climate->file_tmax.scalar,grid,year, 1,config))
+      if(readclimate2(climate,&climate->file_tmax,climate->data[data_index].tmax,grid,year,config))
       {
         if(isroot(*config))
         {
@@ -148,7 +169,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     }
     if(climate->data[0].tmin!=NULL)
     {
-      if(readclimate(&climate->file_tmin,climate->data[data_index].tmin,0,climate->file_tmin.scalar,grid,year,1,config))
+      if(readclimate2(climate,&climate->file_tmin,climate->data[data_index].tmin,grid,year,config))
       {
         if(isroot(*config))
         {
@@ -160,7 +181,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
         return TRUE;
       }
     }
-    if(readclimate(&climate->file_lwnet,climate->data[data_index].lwnet,0,climate->file_lwnet.scalar,grid,year,1,config))
+    if(readclimate2(climate,&climate->file_lwnet,climate->data[data_index].lwnet,grid,year,config))
     {
       if(isroot(*config))
       {
@@ -171,7 +192,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
       }
       return TRUE;
     }
-    if(readclimate(&climate->file_swdown,climate->data[data_index].swdown,0,climate->file_swdown.scalar,grid,year,1,config))
+    if(readclimate2(climate,&climate->file_swdown,climate->data[data_index].swdown,grid,year,config))
     {
       if(isroot(*config))
       {
@@ -184,7 +205,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     }
     if(climate->data[0].humid!=NULL)
     {
-      if(readclimate(&climate->file_humid,climate->data[data_index].humid,0,climate->file_humid.scalar,grid,year,1,config))
+      if(readclimate2(climate,&climate->file_humid,climate->data[data_index].humid,grid,year,config))
       {
         if(isroot(*config))
         {
@@ -196,7 +217,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
         return TRUE;
       }
     }
-    if(readclimate(&climate->file_wind,climate->data[data_index].wind,0,climate->file_wind.scalar,grid,year,1,config))
+    if(readclimate2(climate,&climate->file_wind,climate->data[data_index].wind,grid,year,config))
     {
       if(isroot(*config))
       {
@@ -209,7 +230,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     }
     if(climate->data[0].tamp!=NULL)
     {
-      if(readclimate(&climate->file_tamp,climate->data[0].tamp,0,climate->file_tamp.scalar,grid,year,1,config))
+      if(readclimate2(climate,&climate->file_tamp,climate->data[0].tamp,grid,year,config))
       {
         if(isroot(*config))
         {
@@ -223,7 +244,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
     }
     if(climate->data[0].burntarea!=NULL)
     {
-      if(readclimate(&climate->file_burntarea,climate->data[0].burntarea,0,climate->file_burntarea.scalar,grid,year, 1,config))
+      if(readclimate2(climate,&climate->file_burntarea,climate->data[0].burntarea,grid,year,config))
       {
         if(isroot(*config))
         {
@@ -247,7 +268,7 @@ Bool getclimate(Climate *climate,    /**< pointer to climate data */
       }
       if(index<climate->file_wet.nyear)
       {
-        if(readclimate(&climate->file_wet,climate->data[data_index].wet,0,climate->file_wet.scalar,grid,year, 1,config))
+        if(readclimate2(climate,&climate->file_wet,climate->data[data_index].wet,grid,year,config))
         {
           if(isroot(*config))
           {
@@ -99,6 +99,7 @@ Climate *initclimate(const Cell grid[], /**< LPJ grid */
     printallocerr("climate");
     return NULL;
   }
+  climate->readahead=NULL;
   initdata(climate);
   if(openclimate2(&climate->file_temp,&config->temp_filename,"temp","celsius",LPJ_SHORT,1,0.1,TRUE,config))
   {
@@ -0,0 +1,56 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              m  a  p  c  l  i  m  a  t  e  .  c                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function maps climate data file into memory. Pages of the file             \n**/
+/**     are shared by all tasks running on the same node. If mapping               \n**/
+/**     fails data is read by fread().                                             \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+void mapclimate(Climatefile *file,    /**< pointer to open climate file */
+                const char *filename, /**< filename of climate file */
+                Bool isroot           /**< task is root task (TRUE/FALSE) */
+               )                      /** \return void */
+{
+#ifndef _WIN32
+  void *map;
+  long long size;
+#endif
+  file->map=NULL;
+  file->mapsize=0;
+  if(file->fmt!=RAW && file->fmt!=CLM && file->fmt!=META)
+    return;
+#ifdef _WIN32
+  if(isroot)
+    fprintf(stderr,"WARNING049: Memory mapping of '%s' not supported, file is read.\n",
+            filename);
+#else
+  size=getfilesizep(file->file);
+  if(size<=0)
+    return;
+  map=mmap(NULL,size,PROT_READ,MAP_SHARED,fileno(file->file),0);
+  if(map==MAP_FAILED)
+  {
+    if(isroot)
+      fprintf(stderr,"WARNING049: Cannot map '%s' into memory: %s, file is read.\n",
+              filename,strerror(errno));
+    return;
+  }
+  file->map=map;
+  file->mapsize=size;
+#endif
+} /* of 'mapclimate' */
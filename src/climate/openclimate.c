@@ -34,6 +34,7 @@ Bool openclimate(Climatefile *file,        /**< pointer to climate file */
   int n_attr;
   size_t offset,filesize;
   file->fmt=filename->fmt;
+  file->map=NULL;
   if(filename->fmt==FMS)
   {
     file->time_step=DAY;
@@ -251,6 +252,8 @@ Bool openclimate(Climatefile *file,        /**< pointer to climate file */
   }
   file->size=header.ncell*header.nbands*typesizes[file->datatype];
   file->n=header.nbands*config->ngridcell;
+  if(config->mmap_climate)
+    mapclimate(file,filename->name,isroot(*config));
   file->isopen=TRUE;
   return FALSE;
 } /* of 'openclimate' */
@@ -33,6 +33,7 @@ Bool openclmdata(Climatefile *file,        /**< pointer to file */
   String headername;
   int version;
   size_t offset,filesize;
+  file->map=NULL;
   if((file->file=openinputfile(&header,map,attrs,n_attr,&file->swap,
                                filename,headername,unit,datatype,
                                &version,&offset,TRUE,config))==NULL)
@@ -0,0 +1,225 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**     r  e  a  d  a  h  e  a  d  c  l  i  m  a  t  e  .  c                       \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Functions read and convert raw/clm climate data of next year into          \n**/
+/**     spare buffers while the current year is simulated. getclimate()            \n**/
+/**     copies the converted data at the year boundary instead of reading          \n**/
+/**     them. With pthread support data are read by a separate thread,             \n**/
+/**     otherwise the operating system is advised to read ahead. NetCDF            \n**/
+/**     files are not read ahead, because the NetCDF library is not                \n**/
+/**     thread-safe.                                                               \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+#ifdef USE_PTHREAD
+#include <pthread.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
+
+#define NREADAHEAD 11 /* maximum number of climate files read ahead */
+
+typedef struct
+{
+  const Climatefile *file; /**< climate file */
+  int year;                /**< year of converted data or -1 */
+  Bool rc;                 /**< error reading data (TRUE/FALSE) */
+  Real *data;              /**< converted data of year */
+  int size;                /**< size of data array */
+} Block;
+
+struct readahead
+{
+  Block blocks[NREADAHEAD]; /**< climate data read ahead */
+  int n;                    /**< number of blocks used */
+#ifdef USE_PTHREAD
+  Bool isrunning;           /**< readahead thread is running */
+  pthread_t thread;
+#endif
+}; /* definition of opaque datatype Readahead */
+
+static void addblock(Readahead readahead,const Climatefile *file,int year,
+                     const Config *config)
+{
+  long long index;
+  Block *block;
+  if(!file->isopen || (file->fmt!=RAW && file->fmt!=CLM))
+    return;
+  if(iscoupled(*config) && file->issocket && year>=config->start_coupling)
+    return;
+  index=year-file->firstyear;
+  if(index<0 || index>=file->nyear)
+    return;
+  block=readahead->blocks+readahead->n;
+  block->file=file;
+  block->year=year;
+#ifdef USE_PTHREAD
+  if(file->n>block->size)
+  {
+    free(block->data);
+    block->data=newvec(Real,file->n);
+    if(block->data==NULL)
+    {
+      printallocerr("data");
+      block->size=0;
+      return;
+    }
+    block->size=file->n;
+  }
+#elif defined(POSIX_FADV_WILLNEED)
+  if(file->map==NULL)
+    posix_fadvise(fileno(file->file),index*file->size+file->offset,
+                  file->n*typesizes[file->datatype],POSIX_FADV_WILLNEED);
+  block->year=-1; /* data are not converted in advance */
+#else
+  block->year=-1;
+#endif
+  readahead->n++;
+} /* of 'addblock' */
+
+#ifdef USE_PTHREAD
+
+static Bool readblock(const Block *block)
+{
+  const Climatefile *file;
+  long long index;
+  file=block->file;
+  index=block->year-file->firstyear;
+  if(file->map!=NULL)
+  {
+    if(index*file->size+file->offset+(long long)file->n*typesizes[file->datatype]>(long long)file->mapsize)
+      return TRUE;
+    return convertrealvec((Byte *)file->map+index*file->size+file->offset,
+                          block->data,0,file->scalar,file->n,file->swap,file->datatype);
+  }
+  /* file is not accessed by the main thread until the readahead thread has finished */
+  if(fseek(file->file,index*file->size+file->offset,SEEK_SET))
+    return TRUE;
+  return readrealvec(file->file,block->data,0,file->scalar,file->n,file->swap,
+                     file->datatype);
+} /* of 'readblock' */
+
+static void *reader(void *arg)
+{
+  Readahead readahead;
+  int i;
+  readahead=arg;
+  for(i=0;i<readahead->n;i++)
+    readahead->blocks[i].rc=readblock(readahead->blocks+i);
+  return NULL;
+} /* of 'reader' */
+
+#endif
+
+void waitreadahead(Readahead readahead /**< pointer to readahead data or NULL */
+                  )                   /** \return void */
+{
+#ifdef USE_PTHREAD
+  if(readahead!=NULL && readahead->isrunning)
+  {
+    pthread_join(readahead->thread,NULL);
+    readahead->isrunning=FALSE;
+  }
+#endif
+} /* of 'waitreadahead' */
+
+void readaheadclimate(Climate *climate,    /**< pointer to climate data */
+                      int year,            /**< year of climate data to be read ahead */
+                      const Config *config /**< LPJ configuration */
+                     )                     /** \return void */
+{
+  Readahead readahead;
+  int i;
+  if(climate->readahead==NULL)
+  {
+    climate->readahead=new(struct readahead);
+    if(climate->readahead==NULL)
+    {
+      printallocerr("readahead");
+      return;
+    }
+    for(i=0;i<NREADAHEAD;i++)
+    {
+      climate->readahead->blocks[i].data=NULL;
+      climate->readahead->blocks[i].size=0;
+    }
+#ifdef USE_PTHREAD
+    climate->readahead->isrunning=FALSE;
+#endif
+  }
+  readahead=climate->readahead;
+  waitreadahead(readahead);
+  readahead->n=0;
+  addblock(readahead,&climate->file_temp,year,config);
+  addblock(readahead,&climate->file_prec,year,config);
+  addblock(readahead,&climate->file_lwnet,year,config);
+  addblock(readahead,&climate->file_swdown,year,config);
+  addblock(readahead,&climate->file_wind,year,config);
+  if(climate->data[0].tmax!=NULL)
+    addblock(readahead,&climate->file_tmax,year,config);
+  if(climate->data[0].tmin!=NULL)
+    addblock(readahead,&climate->file_tmin,year,config);
+  if(climate->data[0].humid!=NULL)
+    addblock(readahead,&climate->file_humid,year,config);
+  if(climate->data[0].tamp!=NULL)
+    addblock(readahead,&climate->file_tamp,year,config);
+  if(climate->data[0].burntarea!=NULL)
+    addblock(readahead,&climate->file_burntarea,year,config);
+  if(climate->data[0].wet!=NULL)
+    addblock(readahead,&climate->file_wet,year,config);
+#ifdef USE_PTHREAD
+  if(readahead->n>0)
+  {
+    readahead->isrunning=!pthread_create(&readahead->thread,NULL,reader,readahead);
+    if(!readahead->isrunning)
+      readahead->n=0;
+  }
+#endif
+} /* of 'readaheadclimate' */
+
+Bool getreadahead(Readahead readahead,     /**< pointer to readahead data or NULL */
+                  const Climatefile *file, /**< climate file */
+                  Real data[],             /**< climate data of year */
+                  int year,                /**< year of climate data (AD) */
+                  Bool *rc                 /**< error reading data in advance (TRUE/FALSE) */
+                 )                         /** \return TRUE if data have been read in advance */
+{
+  int i;
+  if(readahead==NULL)
+    return FALSE;
+  waitreadahead(readahead);
+  for(i=0;i<readahead->n;i++)
+    if(readahead->blocks[i].file==file && readahead->blocks[i].year==year)
+    {
+      *rc=readahead->blocks[i].rc;
+      if(!*rc)
+        memcpy(data,readahead->blocks[i].data,sizeof(Real)*file->n);
+      readahead->blocks[i].year=-1; /* data are used only once */
+      return TRUE;
+    }
+  return FALSE;
+} /* of 'getreadahead' */
+
+void freereadahead(Readahead readahead /**< pointer to readahead data or NULL */
+                  )                   /** \return void */
+{
+  int i;
+  if(readahead!=NULL)
+  {
+    waitreadahead(readahead);
+    for(i=0;i<NREADAHEAD;i++)
+      free(readahead->blocks[i].data);
+    free(readahead);
+  }
+} /* of 'freereadahead' */
@@ -12,11 +12,83 @@
 /**                                                                                \n**/
 /**************************************************************************************/
 
+
 #include "lpj.h"
 
-#define checkptr(ptr) if(ptr==NULL) {printallocerr(#ptr); return TRUE; }
+static Bool allocvar(Storedvar *var,          /**< stored variable */
+                     const Climatefile *file, /**< climate file */
+                     Bool isused,             /**< variable is used */
+                     Type type,               /**< datatype of stored data */
+                     int nyear                /**< number of years stored */
+                    )                         /** \return TRUE on error */
+{
+  if(!isused)
+  {
+    var->data=NULL;
+    return FALSE;
+  }
+  /* short values are only stored if values can be recovered without loss */
+  if(type==LPJ_SHORT && ((file->fmt!=RAW && file->fmt!=CLM) || file->datatype!=LPJ_SHORT))
+    type=LPJ_FLOAT;
+  var->type=type;
+  var->scalar=file->scalar;
+  var->n=file->n;
+  var->data=malloc(typesizes[type]*var->n*nyear);
+  return var->data==NULL;
+} /* of 'allocvar' */
+
+static void putvar(Storedvar *var,const Real data[],int year)
+{
+  int i;
+  size_t offset;
+  if(var->data==NULL)
+    return;
+  offset=(size_t)var->n*year;
+  switch(var->type)
+  {
+    case LPJ_SHORT:
+      for(i=0;i<var->n;i++)
+        ((short *)var->data)[offset+i]=(short)floor(data[i]/var->scalar+0.5);
+      break;
+    case LPJ_FLOAT:
+      for(i=0;i<var->n;i++)
+        ((float *)var->data)[offset+i]=(float)data[i];
+      break;
+    default:
+      for(i=0;i<var->n;i++)
+        ((Real *)var->data)[offset+i]=data[i];
+  }
+} /* of 'putvar' */
+
+static void getvar(Real **data,const Storedvar *var,int year,Bool iscopy)
+{
+  int i;
+  size_t offset;
+  if(var->data==NULL)
+    return;
+  offset=(size_t)var->n*year;
+  switch(var->type)
+  {
+    case LPJ_SHORT:
+      for(i=0;i<var->n;i++)
+        (*data)[i]=((short *)var->data)[offset+i]*var->scalar;
+      break;
+    case LPJ_FLOAT:
+      for(i=0;i<var->n;i++)
+        (*data)[i]=((float *)var->data)[offset+i];
+      break;
+    default:
+      if(iscopy)
+        for(i=0;i<var->n;i++)
+          (*data)[i]=((Real *)var->data)[offset+i];
+      else
+        *data=(Real *)var->data+offset; /* climate data point to stored data */
+  }
+} /* of 'getvar' */
+
+#define allocvar2(var,file,isused) if(allocvar(&store->var,&climate->file,isused,type,nyear)) { printallocerr(#var); return TRUE; }
 
-Bool storeclimate(Climatedata *store,  /**< pointer to climate data to be stored */
+Bool storeclimate(Climatestore *store, /**< pointer to climate data to be stored */
                   Climate *climate,    /**< climate pointer data is read */
                   const Cell grid[],   /**< LPJ grid */
                   int firstyear,       /**< first year of climate to be read */
@@ -24,8 +96,8 @@ Bool storeclimate(Climatedata *store,  /**< pointer to climate data to be stored
                   const Config *config /**< LPJ configuration */
                  )                     /** \return TRUE on error */
 {
-  int year,j,index;
-  long count;
+  int year,index;
+  Type type;
   /**
   * allocate arrays for climate storage
   **/
@@ -33,254 +105,100 @@ Bool storeclimate(Climatedata *store,  /**< pointer to climate data to be stored
     index = (config->delta_year>1) ? 3 : 1;
   else
     index = 0;
-  store->temp=newvec(Real,climate->file_temp.n*nyear);
-  checkptr(store->temp);
-  store->prec=newvec(Real,climate->file_prec.n*nyear);
-  checkptr(store->prec);
-  store->no3deposition=NULL;
-  store->nh4deposition=NULL;
-  if(climate->data[0].tmax!=NULL)
-  {
-    store->tmax=newvec(Real,climate->file_tmax.n*nyear);
-    checkptr(store->tmax);
-  }
-  else
-    store->tmax=NULL;
-  if(climate->data[0].humid!=NULL)
-  {
-    store->humid=newvec(Real,climate->file_humid.n*nyear);
-    checkptr(store->humid);
-  }
-  else
-    store->humid=NULL;
-  if(climate->data[0].tmin!=NULL)
-  {
-    store->tmin=newvec(Real,climate->file_tmin.n*nyear);
-    checkptr(store->tmin);
-  }
-  else
-    store->tmin=NULL;
-  store->lwnet=newvec(Real,climate->file_lwnet.n*nyear);
-  checkptr(store->lwnet);
-  store->swdown=newvec(Real,climate->file_swdown.n*nyear);
-  checkptr(store->swdown);
-  if(climate->data[0].wet!=NULL)
-  {
-    store->wet=newvec(Real,climate->file_wet.n*nyear);
-    checkptr(store->wet);
-  }
-  else
-    store->wet=NULL;
-  store->wind=newvec(Real,climate->file_wind.n*nyear);
-  checkptr(store->wind);
-  if(climate->data[0].tamp!=NULL)
-  {
-    store->tamp=newvec(Real,climate->file_tamp.n*nyear);
-    checkptr(store->tamp);
-  }
-  else
-    store->tamp=NULL;
-  if(climate->data[0].burntarea!=NULL)
-  {
-    store->burntarea=newvec(Real,climate->file_burntarea.n*nyear);
-    checkptr(store->burntarea);
-  }
-  else
-    store->burntarea=NULL;
-  if(climate->data[0].no3deposition!=NULL)
-  {
-    store->no3deposition=newvec(Real,climate->file_no3deposition.n*nyear);
-    checkptr(store->no3deposition);
-  }
-  else
-    store->no3deposition=NULL;
-  if(climate->data[0].nh4deposition!=NULL)
-  {
-    store->nh4deposition=newvec(Real,climate->file_nh4deposition.n*nyear);
-    checkptr(store->nh4deposition);
-  }
-  else
-    store->nh4deposition=NULL;
-  if(climate->data[0].lightning!=NULL)
-  {
-    store->lightning=newvec(Real,climate->file_lightning.n);
-    checkptr(store->lightning);
-    for(j=0;j<climate->file_lightning.n;j++)
-      store->lightning[j]=climate->data[0].lightning[j];
-  }
-  else
-    store->lightning=NULL;
-  for(year=firstyear;year<firstyear+nyear;year++)
-  {
-    if(getclimate(climate,grid,index,year,config))
+  type=config->store_climate_type;
+  allocvar2(temp,file_temp,TRUE);
+  allocvar2(prec,file_prec,TRUE);
+  allocvar2(tmax,file_tmax,climate->data[0].tmax!=NULL);
+  allocvar2(humid,file_humid,climate->data[0].humid!=NULL);
+  allocvar2(tmin,file_tmin,climate->data[0].tmin!=NULL);
+  allocvar2(lwnet,file_lwnet,TRUE);
+  allocvar2(swdown,file_swdown,TRUE);
+  /* wet days may be averaged over years, short values cannot be used */
+  if(type==LPJ_SHORT)
+    type=LPJ_FLOAT;
+  allocvar2(wet,file_wet,climate->data[0].wet!=NULL);
+  type=config->store_climate_type;
+  allocvar2(wind,file_wind,TRUE);
+  allocvar2(tamp,file_tamp,climate->data[0].tamp!=NULL);
+  allocvar2(burntarea,file_burntarea,climate->data[0].burntarea!=NULL);
+  allocvar2(no3deposition,file_no3deposition,climate->data[0].no3deposition!=NULL);
+  allocvar2(nh4deposition,file_nh4deposition,climate->data[0].nh4deposition!=NULL);
+  for(year=0;year<nyear;year++)
+  {
+    if(getclimate(climate,grid,index,firstyear+year,config))
       return TRUE;
-    count=climate->file_temp.n*(year-firstyear);
-    for(j=0;j<climate->file_temp.n;j++)
-      store->temp[count++]=climate->data[index].temp[j];
-    count=climate->file_prec.n*(year-firstyear);
-    for(j=0;j<climate->file_prec.n;j++)
-      store->prec[count++]=climate->data[index].prec[j];
-    if(store->tmax!=NULL)
-    {
-      count=climate->file_tmax.n*(year-firstyear);
-      for(j=0;j<climate->file_tmax.n;j++)
-        store->tmax[count++]=climate->data[index].tmax[j];
-    }
-    if(store->humid!=NULL)
-    {
-      count=climate->file_humid.n*(year-firstyear);
-      for(j=0;j<climate->file_humid.n;j++)
-        store->humid[count++]=climate->data[index].humid[j];
-    }
-    if(store->tmin!=NULL)
-    {
-      count=climate->file_tmin.n*(year-firstyear);
-      for(j=0;j<climate->file_tmin.n;j++)
-        store->tmin[count++]=climate->data[index].tmin[j];
-    }
-    count=climate->file_lwnet.n*(year-firstyear);
-    for(j=0;j<climate->file_lwnet.n;j++)
-      store->lwnet[count++]=climate->data[index].lwnet[j];
-    count=climate->file_swdown.n*(year-firstyear);
-    for(j=0;j<climate->file_swdown.n;j++)
-      store->swdown[count++]=climate->data[index].swdown[j];
-    if(store->wet!=NULL)
-    {
-      count=climate->file_wet.n*(year-firstyear);
-      for(j=0;j<climate->file_wet.n;j++)
-        store->wet[count++]=climate->data[index].wet[j];
-    }
-    if(store->wind!=NULL)
-    {
-      count=climate->file_wind.n*(year-firstyear);
-      for(j=0;j<climate->file_wind.n;j++)
-        store->wind[count++]=climate->data[index].wind[j];
-    }
-    if(store->tamp!=NULL)
-    {
-      count=climate->file_tamp.n*(year-firstyear);
-      for(j=0;j<climate->file_tamp.n;j++)
-        store->tamp[count++]=climate->data[index].tamp[j];
-    }
-    if(store->burntarea!=NULL)
-    {
-      count=climate->file_burntarea.n*(year-firstyear);
-      for(j=0;j<climate->file_burntarea.n;j++)
-        store->burntarea[count++]=climate->data[index].burntarea[j];
-    }
-    if(store->no3deposition!=NULL)
-    {
-      count=climate->file_no3deposition.n*(year-firstyear);
-      for(j=0;j<climate->file_no3deposition.n;j++)
-        store->no3deposition[count++]=climate->data[index].no3deposition[j];
-    }
-    if(store->nh4deposition!=NULL)
-    {
-      count=climate->file_nh4deposition.n*(year-firstyear);
-      for(j=0;j<climate->file_nh4deposition.n;j++)
-        store->nh4deposition[count++]=climate->data[index].nh4deposition[j];
-    }
+    putvar(&store->temp,climate->data[index].temp,year);
+    putvar(&store->prec,climate->data[index].prec,year);
+    putvar(&store->tmax,climate->data[index].tmax,year);
+    putvar(&store->humid,climate->data[index].humid,year);
+    putvar(&store->tmin,climate->data[index].tmin,year);
+    putvar(&store->lwnet,climate->data[index].lwnet,year);
+    putvar(&store->swdown,climate->data[index].swdown,year);
+    putvar(&store->wet,climate->data[index].wet,year);
+    putvar(&store->wind,climate->data[index].wind,year);
+    putvar(&store->tamp,climate->data[index].tamp,year);
+    putvar(&store->burntarea,climate->data[index].burntarea,year);
+    putvar(&store->no3deposition,climate->data[index].no3deposition,year);
+    putvar(&store->nh4deposition,climate->data[index].nh4deposition,year);
   }
   return FALSE;
 } /* of 'storeclimate' */
 
-void restoreclimate(Climate *climate,         /**< pointer to climate data */
-                    const Climatedata *store, /**< pointer to climate data */
-                    int year                  /**< year (AD) */
-                    )                         /** \return void*/
+void restoreclimate(Climate *climate,          /**< pointer to climate data */
+                    const Climatestore *store, /**< pointer to stored climate data */
+                    int year                   /**< year (AD) */
+                    )                          /** \return void*/
 {
-  int i;
-  long index;
-  index=year*climate->file_temp.n;
-  for(i=0;i<climate->file_temp.n;i++)
-    climate->data[0].temp[i]=store->temp[index++];
-  index=year*climate->file_prec.n;
-  for(i=0;i<climate->file_prec.n;i++)
-    climate->data[0].prec[i]=store->prec[index++];
-  if(store->tmax!=NULL)
-  {
-    index=year*climate->file_tmax.n;
-    for(i=0;i<climate->file_tmax.n;i++)
-      climate->data[0].tmax[i]=store->tmax[index++];
-  }
-  if(store->humid!=NULL)
-  {
-    index=year*climate->file_humid.n;
-    for(i=0;i<climate->file_humid.n;i++)
-      climate->data[0].humid[i]=store->humid[index++];
-  }
-  if(store->tmin!=NULL)
-  {
-    index=year*climate->file_tmin.n;
-    for(i=0;i<climate->file_tmin.n;i++)
-      climate->data[0].tmin[i]=store->tmin[index++];
-  }
-  index=year*climate->file_lwnet.n;
-  for(i=0;i<climate->file_lwnet.n;i++)
-    climate->data[0].lwnet[i]=store->lwnet[index++];
-  index=year*climate->file_swdown.n;
-  for(i=0;i<climate->file_swdown.n;i++)
-    climate->data[0].swdown[i]=store->swdown[index++];
-  if(store->wet!=NULL)
-  {
-    index=year*climate->file_wet.n;
-    for(i=0;i<climate->file_wet.n;i++)
-      climate->data[0].wet[i]=store->wet[index++];
-  }
-  index=year*climate->file_wind.n;
-  for(i=0;i<climate->file_wind.n;i++)
-    climate->data[0].wind[i]=store->wind[index++];
-  if(store->tamp!=NULL)
-  {
-    index=year*climate->file_tamp.n;
-    for(i=0;i<climate->file_tamp.n;i++)
-      climate->data[0].tamp[i]=store->tamp[index++];
-  }
-  if(store->burntarea!=NULL)
-  {
-    index=year*climate->file_burntarea.n;
-    for(i=0;i<climate->file_burntarea.n;i++)
-      climate->data[0].burntarea[i]=store->burntarea[index++];
-  }
-  if(store->no3deposition!=NULL)
-  {
-    index=year*climate->file_no3deposition.n;
-    for(i=0;i<climate->file_no3deposition.n;i++)
-      climate->data[0].no3deposition[i]=store->no3deposition[index++];
-  }
-  if(store->nh4deposition!=NULL)
-  {
-    index=year*climate->file_nh4deposition.n;
-    for(i=0;i<climate->file_nh4deposition.n;i++)
-      climate->data[0].nh4deposition[i]=store->nh4deposition[index++];
-  }
+  getvar(&climate->data[0].prec,&store->prec,year,TRUE);
+  getvar(&climate->data[0].temp,&store->temp,year,TRUE);
+  getvar(&climate->data[0].tmax,&store->tmax,year,TRUE);
+  getvar(&climate->data[0].tmin,&store->tmin,year,TRUE);
+  getvar(&climate->data[0].humid,&store->humid,year,TRUE);
+  getvar(&climate->data[0].lwnet,&store->lwnet,year,TRUE);
+  getvar(&climate->data[0].swdown,&store->swdown,year,TRUE);
+  getvar(&climate->data[0].wet,&store->wet,year,TRUE);
+  getvar(&climate->data[0].wind,&store->wind,year,TRUE);
+  getvar(&climate->data[0].tamp,&store->tamp,year,TRUE);
+  getvar(&climate->data[0].burntarea,&store->burntarea,year,TRUE);
+  getvar(&climate->data[0].no3deposition,&store->no3deposition,year,TRUE);
+  getvar(&climate->data[0].nh4deposition,&store->nh4deposition,year,TRUE);
 } /* of 'restoreclimate' */
 
-void moveclimate(Climate *climate,  /**< Pointer to climate data */
-                 const Climatedata *store, /**< climate buffer */
+void moveclimate(Climate *climate,          /**< Pointer to climate data */
+                 const Climatestore *store, /**< climate buffer */
                  int index,
-                 int year           /**< year (AD) */
-                 )                  /** \return void */
+                 int year                   /**< year (AD) */
+                 )                          /** \return void */
 {
-  climate->data[index].prec=store->prec+climate->file_prec.n*year;
-  climate->data[index].temp=store->temp+climate->file_temp.n*year;
-  if(climate->data[index].tmax!=NULL)
-    climate->data[index].tmax=store->tmax+climate->file_tmax.n*year;
-  if(climate->data[index].tmin!=NULL)
-    climate->data[index].tmin=store->tmin+climate->file_tmin.n*year;
-  if(climate->data[index].humid!=NULL)
-    climate->data[index].humid=store->humid+climate->file_humid.n*year;
-  climate->data[index].lwnet=store->lwnet+climate->file_lwnet.n*year;
-  climate->data[index].swdown=store->swdown+climate->file_swdown.n*year;
-  if(climate->data[0].wet!=NULL)
-    climate->data[index].wet=store->wet+climate->file_wet.n*year;
-  climate->data[index].wind=store->wind+climate->file_wind.n*year;
-  if(climate->data[0].tamp!=NULL)
-    climate->data[index].tamp=store->tamp+climate->file_tamp.n*year;
-  if(climate->data[0].burntarea!=NULL)
-    climate->data[index].burntarea=store->burntarea+climate->file_burntarea.n*year;
-  if(climate->data[0].no3deposition!=NULL)
-    climate->data[index].no3deposition=store->no3deposition+climate->file_no3deposition.n*year;
-  if(climate->data[0].nh4deposition!=NULL)
-    climate->data[index].nh4deposition=store->nh4deposition+climate->file_nh4deposition.n*year;
+  getvar(&climate->data[index].prec,&store->prec,year,FALSE);
+  getvar(&climate->data[index].temp,&store->temp,year,FALSE);
+  getvar(&climate->data[index].tmax,&store->tmax,year,FALSE);
+  getvar(&climate->data[index].tmin,&store->tmin,year,FALSE);
+  getvar(&climate->data[index].humid,&store->humid,year,FALSE);
+  getvar(&climate->data[index].lwnet,&store->lwnet,year,FALSE);
+  getvar(&climate->data[index].swdown,&store->swdown,year,FALSE);
+  getvar(&climate->data[index].wet,&store->wet,year,FALSE);
+  getvar(&climate->data[index].wind,&store->wind,year,FALSE);
+  getvar(&climate->data[index].tamp,&store->tamp,year,FALSE);
+  getvar(&climate->data[index].burntarea,&store->burntarea,year,FALSE);
+  getvar(&climate->data[index].no3deposition,&store->no3deposition,year,FALSE);
+  getvar(&climate->data[index].nh4deposition,&store->nh4deposition,year,FALSE);
 } /* of 'moveclimate' */
+
+void freeclimatestore(Climatestore *store /**< pointer to stored climate data */
+                     )                    /** \return void */
+{
+  free(store->temp.data);
+  free(store->prec.data);
+  free(store->tmax.data);
+  free(store->humid.data);
+  free(store->tmin.data);
+  free(store->lwnet.data);
+  free(store->swdown.data);
+  free(store->wet.data);
+  free(store->wind.data);
+  free(store->tamp.data);
+  free(store->burntarea.data);
+  free(store->no3deposition.data);
+  free(store->nh4deposition.data);
+} /* of 'freeclimatestore' */
@@ -64,6 +64,10 @@ Real daily_agriculture(Stand *stand,                /**< [inout] stand pointer *
   Irrigation *data;
   Output *output;
   Pftcrop *crop;
+#ifdef USE_TIMING
+  double tstart;
+  timing_start(DAILY_AGRICULTURE_FCN,tstart);
+#endif
   irrig_apply=0.0;
   isrice=FALSE;
 #if defined(CHECK_BALANCE) || defined(DEBUG)
@@ -624,6 +628,9 @@ Real daily_agriculture(Stand *stand,                /**< [inout] stand pointer *
         __FUNCTION__,year,day,balancew,water_before,water_after,transp,evap,intercep_stand,intercep_stand_blue,runoff,(climate->prec+melt+rw_apply+irrig_apply),(wfluxes_new-wfluxes_old)/stand->frac,irrig_apply,data->irrig_stor,
         stand->frac,isrice,(wstore_new-wstore_old)/stand->frac,wstore_new,wstore_old);
   }
+#endif
+#ifdef USE_TIMING
+  timing_stop(DAILY_AGRICULTURE_FCN,tstart);
 #endif
   return runoff;
 } /* of 'daily_agriculture' */
@@ -86,6 +86,10 @@ Real daily_grassland(Stand *stand,                /**< stand pointer */
   Real lateral_in=0;
 #ifdef PERMUTE
   int *pvec;
+#endif
+#ifdef USE_TIMING
+  double tstart;
+  timing_start(DAILY_GRASSLAND_FCN,tstart);
 #endif
   irrig_apply=0.0;
 #if defined(DEBUG) || defined(CHECK_BALANCE)
@@ -713,6 +717,9 @@ Real daily_grassland(Stand *stand,                /**< stand pointer */
   free(wet);
 #ifdef PERMUTE
   free(pvec);
+#endif
+#ifdef USE_TIMING
+  timing_stop(DAILY_GRASSLAND_FCN,tstart);
 #endif
   return runoff;
 } /* of 'daily_grassland' */
@@ -1397,6 +1397,9 @@ void landusechange(Cell *cell,          /**< pointer to cell */
   Real sum[2],sum_wl; /* rainfed, irrigated */
   int s,s2,pos;
   int i,p;
+#ifdef USE_TIMING
+  double tstart;
+#endif
 #if defined IMAGE && defined COUPLED
   int nnat;
   Real timberharvest=0;
@@ -1442,6 +1445,9 @@ void landusechange(Cell *cell,          /**< pointer to cell */
   fluxes_neg=cell->balance.neg_fluxes;
   fluxes_prod.carbon=(cell->balance.deforest_emissions.carbon+cell->balance.prod_turnover.fast.carbon+cell->balance.prod_turnover.slow.carbon+cell->balance.trad_biofuel.carbon);
   fluxes_prod.nitrogen=(cell->balance.deforest_emissions.nitrogen+cell->balance.prod_turnover.fast.nitrogen+cell->balance.prod_turnover.slow.nitrogen+cell->balance.trad_biofuel.nitrogen);
+#endif
+#ifdef USE_TIMING
+  timing_start(LANDUSECHANGE_FCN,tstart);
 #endif
   if(cell->ml.dam)
     landusechange_for_reservoir(cell,npft,ncft,intercrop,year,config);
@@ -1873,6 +1879,9 @@ void landusechange(Cell *cell,          /**< pointer to cell */
     fail(INVALID_NITROGEN_BALANCE_ERR,config->fail_on_balance,FALSE,"Invalid nitrogen balance in %s at the end: year=%d: error=%g start : %g end : %g balance.nitrogen: %g",
          __FUNCTION__,year, start.nitrogen-end.nitrogen+balance.nitrogen,start.nitrogen,end.nitrogen,balance.nitrogen);
 #endif
+#ifdef USE_TIMING
+  timing_stop(LANDUSECHANGE_FCN,tstart);
+#endif
 } /* of 'landusechange' */
 
 
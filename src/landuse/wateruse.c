@@ -34,7 +34,7 @@ void wateruse(Cell *grid,          /**< LPJ grid */
   Real wd_gw=0;
 #ifdef USE_TIMING
   double t;
-  timing_start(t);
+  timing_start(WATERUSE_FCN,t);
 #endif
 
   in=(Real *)pnet_input(config->irrig_back);
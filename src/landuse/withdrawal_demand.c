@@ -112,11 +112,11 @@ void withdrawal_demand(Cell *grid,          /**< LPJ grid */
 
 #ifdef USE_TIMING
 #ifdef USE_MPI
-  timing_start(t);
+  timing_start(MPI_BARRIER_FCN,t);
   MPI_Barrier(config->comm);
   timing_stop(MPI_BARRIER_FCN,t);
 #endif
-  timing_start(t);
+  timing_start(WITHDRAWAL_DEMAND_FCN,t);
 #endif
   pnet_exchg(config->irrig_neighbour);
 
@@ -42,8 +42,8 @@ int writecountrycode(Outputfile *output,  /**< output file array */
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        mpi_write(output->files[index].fp.file,vec,MPI_SHORT,config->total,
-                  output->counts,output->offsets,config->rank,config->comm);
+        mpi_write_file(output->files+index,vec,MPI_SHORT,config->total,
+                       output->counts,output->offsets,config->rank,config->comm);
         break;
       case TXT:
         mpi_write_txt(output->files[index].fp.file,vec,MPI_SHORT,config->total,
@@ -0,0 +1,100 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**            c  h  e  c  k  s  p  i  n  u  p  .  c                               \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Checks convergence of carbon and nitrogen stocks during spinup             \n**/
+/**     Stocks are averaged over windows of spinup_window years. If the            \n**/
+/**     relative change of the mean stocks between two subsequent windows          \n**/
+/**     is less than spinup_tolerance, the cell is marked as converged and         \n**/
+/**     is not simulated until the end of the spinup.                              \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+static Bool isconverged(Real mean,     /**< mean stocks of current window */
+                        Real mean_old, /**< mean stocks of previous window */
+                        Real tol       /**< relative tolerance */
+                       )               /** \return TRUE if converged */
+{
+  return fabs(mean-mean_old)<=tol*fabs(mean) || fabs(mean-mean_old)<epsilon;
+} /* of 'isconverged' */
+
+Bool checkspinup(Cell grid[],         /**< cell array */
+                 int year,            /**< simulation year (AD) */
+                 const Config *config /**< LPJmL configuration */
+                )                     /** \return TRUE if stocks of all cells have converged */
+{
+  const Stand *stand;
+  Stocks stocks,mean;
+  int cell,s,window,firstyear,count;
+#ifdef USE_MPI
+  int count_total;
+#endif
+  /* check starts after the last soil equilibration */
+  firstyear=config->firstyear-config->nspinup;
+  if(config->equilsoil)
+    firstyear+=param.veg_equil_year+param.equisoil_interval*param.nequilsoil+param.equisoil_fadeout;
+  if(year<=firstyear)
+    return FALSE;
+  window=(year-firstyear-1)/config->spinup_window; /* index of current window */
+  count=0;
+  for(cell=0;cell<config->ngridcell;cell++)
+    if(!grid[cell].skip)
+    {
+      stocks.carbon=stocks.nitrogen=0;
+      foreachstand(stand,s,grid[cell].standlist)
+      {
+        mean=standstocks(stand);
+        stocks.carbon+=mean.carbon*stand->frac;
+        stocks.nitrogen+=mean.nitrogen*stand->frac;
+      }
+      grid[cell].spinup_sum.carbon+=stocks.carbon;
+      grid[cell].spinup_sum.nitrogen+=stocks.nitrogen;
+      if((year-firstyear) % config->spinup_window==0)
+      {
+        /* end of window reached, compare mean stocks with previous window */
+        mean.carbon=grid[cell].spinup_sum.carbon/config->spinup_window;
+        mean.nitrogen=grid[cell].spinup_sum.nitrogen/config->spinup_window;
+        grid[cell].isconverged=window>0 &&
+                               isconverged(mean.carbon,grid[cell].spinup_mean.carbon,config->spinup_tolerance) &&
+                               isconverged(mean.nitrogen,grid[cell].spinup_mean.nitrogen,config->spinup_tolerance);
+        /* cells connected by river routing have to be simulated */
+        if(grid[cell].isconverged && !config->river_routing)
+          grid[cell].skip=TRUE;
+        grid[cell].spinup_mean=mean;
+        grid[cell].spinup_sum.carbon=grid[cell].spinup_sum.nitrogen=0;
+      }
+      if(!grid[cell].isconverged)
+        count++;
+    }
+  if((year-firstyear) % config->spinup_window)
+    return FALSE;
+#ifdef USE_MPI
+  MPI_Allreduce(&count,&count_total,1,MPI_INT,MPI_SUM,config->comm);
+  count=count_total;
+#endif
+  return count==0;
+} /* of 'checkspinup' */
+
+void unfreezecells(Cell grid[],         /**< cell array */
+                   const Config *config /**< LPJmL configuration */
+                  )
+{
+  int cell;
+  for(cell=0;cell<config->ngridcell;cell++)
+    if(grid[cell].isconverged)
+    {
+      if(!config->river_routing)
+        grid[cell].skip=FALSE;
+      grid[cell].isconverged=FALSE;
+    }
+} /* of 'unfreezecells' */
@@ -21,16 +21,35 @@ void closeoutput_yearly(Outputfile *output, /**< Output data */
                        )
 {
  int i;
+ if(output->queue!=NULL)
+   for(i=0;i<config->n_out;i++)
+     if(config->outputvars[i].oneyear && output->files[config->outputvars[i].id].isopen)
+     {
+       syncwritequeue(output->queue); /* wait until all data of yearly files have been written */
+       break;
+     }
  if(isroot(*config))
    for(i=0;i<config->n_out;i++)
      if(config->outputvars[i].oneyear && output->files[config->outputvars[i].id].isopen)
        switch(config->outputvars[i].filename.fmt)
        {
          case RAW: case TXT: case CLM:
+#ifdef USE_MPI
+           if(output->files[config->outputvars[i].id].isparallel)
+             break;
+#endif
            fclose(output->files[config->outputvars[i].id].fp.file);
            break;
          case CDF:
            close_netcdf(&output->files[config->outputvars[i].id].fp.cdf);
            break;
        }
+#ifdef USE_MPI
+ for(i=0;i<config->n_out;i++)
+   if(config->outputvars[i].oneyear && output->files[config->outputvars[i].id].isparallel)
+   {
+     MPI_File_close(&output->files[config->outputvars[i].id].fh);
+     output->files[config->outputvars[i].id].isparallel=FALSE;
+   }
+#endif
 } /* of 'closeoutput_yearly' */
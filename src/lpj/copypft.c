@@ -32,6 +32,7 @@ void copypft(Pft *dst, const Pft *src)
   dst->npp_bnf = src->npp_bnf;
   dst->vscal = src->vscal;
   dst->vmax = src->vmax;
+  dst->lambda = src->lambda;
   dst->nlimit = src->nlimit;
   dst->fapar = src->fapar;
   dst->nleaf = src->nleaf;
@@ -64,6 +64,10 @@ Real daily_natural(Stand *stand,                /**< [inout] stand pointer */
   Stocks flux_estab = {0,0};
 #endif
   Soil *soil;
+#ifdef USE_TIMING
+  double tstart;
+  timing_start(DAILY_NATURAL_FCN,tstart);
+#endif
   soil = &stand->soil;
   output=&stand->cell->output;
 #ifdef DEBUG
@@ -356,6 +360,9 @@ Real daily_natural(Stand *stand,                /**< [inout] stand pointer */
   free(wet);
 #ifdef PERMUTE
   free(pvec);
+#endif
+#ifdef USE_TIMING
+  timing_stop(DAILY_NATURAL_FCN,tstart);
 #endif
   return runoff;
 } /* of 'daily_natural' */
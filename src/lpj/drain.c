@@ -47,8 +47,8 @@ void drain(Cell grid[],         /**< Cell array */
            const Config *config /**< LPJmL configuration */
           )
 {
-  int count,cell,i,j,iter,t,ncoeff;
-  Real fin,*out,*in;
+  int count,cell,i,j,iter,next,lo,hi;
+  Real fin,*out,*in,*fin_local;
   Real fout_lake,irrig_to_river;
 #ifdef USE_TIMING
   double tstart;
@@ -56,6 +56,7 @@ void drain(Cell grid[],         /**< Cell array */
   count=(int)(1.0/TSTEP); /* calculate number of iterations */
   out=(Real *)pnet_output(config->route);
   in=(Real *)pnet_input(config->route);
+  fin_local=config->fin_local; /* allocated in initdrain() */
 
   for(cell=0;cell<config->ngridcell;cell++)
   {
@@ -117,23 +118,23 @@ void drain(Cell grid[],         /**< Cell array */
 
   grid-=config->startgrid-config->firstgrid; /* adjust first index of grid
                                               array needed for pnet library */
+  fin_local-=config->startgrid-config->firstgrid;
+  lo=config->startgrid-config->firstgrid;
+  hi=lo+config->ngridcell-1;
 #ifdef USE_TIMING
 #ifdef USE_MPI
-  timing_start(tstart);
+  timing_start(MPI_BARRIER_FCN,tstart);
   MPI_Barrier(config->comm);
   timing_stop(MPI_BARRIER_FCN,tstart);
 #endif
-  timing_start(tstart);
+  timing_start(DRAIN_FCN,tstart);
 #endif
   for(iter=0;iter<count;iter++)
   {
     for(i=pnet_lo(config->route);i<=pnet_hi(config->route);i++)
     {
       /* calculate outflow */
-      grid[i].discharge.fout=0;
-      ncoeff=queuesize(grid[i].discharge.queue);
-      for(t=0;t<ncoeff;t++)
-        grid[i].discharge.fout+=getqueue(grid[i].discharge.queue,t)*grid[i].discharge.tfunct[t];
+      grid[i].discharge.fout=convqueue(grid[i].discharge.queue,grid[i].discharge.tfunct);
 
       grid[i].discharge.dmass_river-=grid[i].discharge.fout;
       grid[i].discharge.dfout+=grid[i].discharge.fout;
@@ -160,6 +161,16 @@ void drain(Cell grid[],         /**< Cell array */
     /* communication function fills input buffer */
     pnet_exchg(config->route);
 
+    /* sum up inflows from cells of the same task without communication */
+    for(i=lo;i<=hi;i++)
+      fin_local[i]=0;
+    for(i=lo;i<=hi;i++)
+    {
+      next=grid[i].discharge.next-config->firstgrid;
+      if(grid[i].discharge.next>=0 && next>=lo && next<=hi)
+        fin_local[next]+=grid[i].discharge.fout;
+    }
+
     for(i=pnet_lo(config->route);i<=pnet_hi(config->route);i++)
     {
       if(iter==0)
@@ -169,7 +180,8 @@ void drain(Cell grid[],         /**< Cell array */
       }
       else
         fin=0;
-      /* sum up all inflows from other cells */
+      fin+=fin_local[i];
+      /* sum up all inflows from cells of other tasks */
       for(j=0;j<pnet_inlen(config->route,i);j++)
         fin+=in[pnet_inindex(config->route,i,j)];
 
@@ -44,14 +44,24 @@ void fcloseoutput(Outputfile *output,  /**< Output file array */
                  )
 {
   int i;
+  /* wait until all data have been written by writer thread, errors are reported by writer */
+  freewritequeue(output->queue);
   for(i=0;i<output->n;i++)
     if(output->files[i].isopen)  /* output file is open? */
     {
+#ifdef USE_MPI
+      if(output->files[i].isparallel && !output->files[i].oneyear)
+        MPI_File_close(&output->files[i].fh);
+#endif
       if(isroot(*config) && !output->files[i].oneyear)
       {
         switch(output->files[i].fmt)
         {
           case RAW: case TXT:
+#ifdef USE_MPI
+            if(output->files[i].isparallel)
+              break;
+#endif
             fclose(output->files[i].fp.file);
             break;
           case CDF:
@@ -475,8 +475,9 @@ static int checkclmfile(Config *config,const char *data_name,const Filename *fil
 static int checkrestartfile(Config *config, const char *filename)
 {
   Bstruct file;
+  /* only header is checked, cell data need not to be read into memory */
   file=openrestart(filename,config,
-                   config->npft[GRASS]+config->npft[TREE],config->npft[CROP]);
+                   config->npft[GRASS]+config->npft[TREE],config->npft[CROP],FALSE);
   if(file==NULL)
     return 1;
   bstruct_finish(file);
@@ -50,6 +50,39 @@ static Bool create(Netcdf *cdf,const char *filename,int index,
                              (config->outnames[config->outputvars[index].id].timestep==ANNUAL) ? 1 : config->outnames[config->outputvars[index].id].timestep,0,FALSE,array,config);
 } /* of 'create' */
 
+#ifdef USE_MPI
+
+static void openparallel(File *file,const char *filename,int id,const Config *config)
+{
+  long long pos;
+  int rc;
+  if(!config->parallel_output || !file->isopen || (file->fmt!=RAW && file->fmt!=CLM) ||
+     id==GRID || id==GLOBALFLUX || id==PCO2 || id==PCH4)
+    return;
+  /* header has been written by root task, file is reopened by all tasks */
+  if(isroot(*config))
+  {
+    pos=ftell(file->fp.file);
+    fclose(file->fp.file);
+  }
+  MPI_Bcast(&pos,1,MPI_LONG_LONG,0,config->comm);
+  rc=MPI_File_open(config->comm,(char *)filename,MPI_MODE_WRONLY,MPI_INFO_NULL,&file->fh);
+  if(iserror(rc!=MPI_SUCCESS,config))
+  {
+    if(isroot(*config))
+      fprintf(stderr,"ERROR272: Cannot open output file '%s' for parallel write.\n",
+              filename);
+    if(rc==MPI_SUCCESS)
+      MPI_File_close(&file->fh);
+    file->isopen=FALSE;
+    return;
+  }
+  file->pos=pos;
+  file->isparallel=TRUE;
+} /* of 'openparallel' */
+
+#endif
+
 static void openfile(Outputfile *output,const Cell grid[],
                      const char *filename,int i,
                      const Config *config)
@@ -251,8 +284,25 @@ Outputfile *fopenoutput(const Cell grid[],   /**< LPJ grid */
   check(output->files);
   output->n=n;
   output->index=output->index_all=NULL; 
+  output->queue=NULL;
+  if(config->async_output && isroot(*config))
+  {
+    /* only root task writes files, writer thread is created on root task */
+    output->queue=newwritequeue(WRITEQUEUE_SIZE);
+    if(output->queue==NULL)
+      fputs("WARNING048: Cannot create asynchronous write queue, output is written synchronously.\n",stderr);
+  }
+#ifdef USE_MPI
+  output->isasync=(output->queue!=NULL);
+  MPI_Bcast(&output->isasync,1,MPI_INT,0,config->comm);
+#endif
   for(i=0;i<n;i++)
+  {
     output->files[i].isopen=output->files[i].issocket=output->files[i].oneyear=FALSE;
+#ifdef USE_MPI
+    output->files[i].isparallel=FALSE;
+#endif
+  }
 #ifdef USE_MPI
   output->counts=newvec(int,config->ntask);
   check(output->counts);
@@ -319,6 +369,8 @@ Outputfile *fopenoutput(const Cell grid[],   /**< LPJ grid */
 #ifdef USE_MPI
     MPI_Bcast(&output->files[config->outputvars[i].id].isopen,1,MPI_INT,
               0,config->comm);
+    if(!config->outputvars[i].oneyear)
+      openparallel(output->files+config->outputvars[i].id,filename,config->outputvars[i].id,config);
 #endif
     if(config->pedantic && config->outputvars[i].filename.fmt!=SOCK && !output->files[config->outputvars[i].id].isopen)
       return NULL;
@@ -428,6 +480,13 @@ void openoutput_yearly(Outputfile *output,int year,const Config *config)
       } /* of(isroot(*config)) */
 #ifdef USE_MPI
       MPI_Bcast(&output->files[config->outputvars[i].id].isopen,1,MPI_INT,0,config->comm);
+      if(config->parallel_output && output->files[config->outputvars[i].id].isopen)
+      {
+        filename=getsprintf(config->outputvars[i].filename.name,year);
+        check(filename);
+        openparallel(output->files+config->outputvars[i].id,filename,config->outputvars[i].id,config);
+        free(filename);
+      }
 #endif
     }
 } /* of 'openoutput_yearly */
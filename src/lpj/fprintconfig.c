@@ -274,9 +274,10 @@ void fprintconfig(FILE *file,          /**< File pointer to text output file */
   fprintattrs(file,config->global_attrs,config->n_global);
   fprintf(file,"Simulation \"%s\"",config->sim_name);
   if(config->ntask>1)
-    fprintf(file," running on %d tasks\n",config->ntask);
-  else
-    putc('\n',file);
+    fprintf(file," running on %d tasks",config->ntask);
+  if(config->nthreads>1)
+    fprintf(file,"%s %d threads",(config->ntask>1) ? " with" : " running on",config->nthreads);
+  putc('\n',file);
   len=0;
   if(!config->fail_on_balance)
     len=printsim(file,len,&count,"no fail on balance error");
@@ -379,6 +380,8 @@ void fprintconfig(FILE *file,          /**< File pointer to text output file */
 #endif
   if(config->johansen)
     len=printsim(file,len,&count,"Johansen conductivity");
+  if(config->lambda_solver==ILLINOIS_SOLVER)
+    len=printsim(file,len,&count,"Illinois solver for lambda");
   if(config->percolation_heattransfer)
     len=printsim(file,len,&count,"percolation heattransfer");
   if(config->prescribe_landcover)
@@ -856,6 +859,10 @@ void fprintconfig(FILE *file,          /**< File pointer to text output file */
     fprintf(file,"Spinup years:                %8d\n"
             "Cycle length during spinup:  %8d\n",
              config->nspinup,config->nspinyear);
+    if(config->spinup_convergence)
+      fprintf(file,"Spinup convergence window:   %8d\n"
+              "Spinup convergence tolerance:%8g\n",
+              config->spinup_window,config->spinup_tolerance);
   }
   else
     fputs("No spinup years.\n",file);
@@ -92,6 +92,13 @@ Bool freadpft(Bstruct file,          /**< pointer to restart file */
   readreal(file,"albedo",&pft->albedo);
   readreal(file,"fapar",&pft->fapar);
   readreal(file,"nleaf",&pft->nleaf);
+  /* restart files of previous versions do not contain start value for Illinois solver */
+  if(bstruct_isdefined(file,"lambda"))
+  {
+    readreal(file,"lambda",&pft->lambda);
+  }
+  else
+    pft->lambda=LAMBDA_OPT;
   if(freadstocks(file,"establish",&pft->establish))
   {
     fprintf(stderr,"ERROR254: Cannot read establish for PFT '%s'.\n",pft->par->name);
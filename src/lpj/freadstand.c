@@ -31,7 +31,7 @@ Stand *freadstand(Bstruct file, /**< pointer to restart file */
   Byte landusetype;
   if(bstruct_readbeginstruct(file,name))
     return NULL;
-  stand=new(Stand);
+  stand=allocstand();
   if(stand==NULL)
   {
     printallocerr("stand");
@@ -40,14 +40,14 @@ Stand *freadstand(Bstruct file, /**< pointer to restart file */
   stand->cell=cell;
   if(bstruct_readbyte(file,"landusetype",&landusetype))
   {
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   if(landusetype>=nstand)
   {
     fprintf(stderr,"ERROR196: Invalid value %d for stand type, must be in [0,%d].\n",
             landusetype,nstand-1);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   stand->type=standtype+landusetype;
@@ -55,31 +55,31 @@ Stand *freadstand(Bstruct file, /**< pointer to restart file */
   if(freadsoil(file,"soil",&stand->soil,soilpar,pftpar,ntotpft))
   {
     fprintf(stderr,"ERROR254: Cannot read soil data for %s stand.\n",stand->type->name);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   if(freadpftlist(file,"pftlist",stand,&stand->pftlist,pftpar,ntotpft,separate_harvests))
   {
     fprintf(stderr,"ERROR254: Cannot read PFT list for %s stand.\n",stand->type->name);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   if(bstruct_readreal(file,"Hag_Beta",&stand->Hag_Beta))
   {
     fprintf(stderr,"ERROR254: Cannot read Hag_Beta for %s stand.\n",stand->type->name);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   if(bstruct_readreal(file,"slope_mean",&stand->slope_mean))
   {
     fprintf(stderr,"ERROR254: Cannot read slope_mean for %s stand.\n",stand->type->name);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   if(bstruct_readreal(file,"frac",&stand->frac))
   {
     fprintf(stderr,"ERROR254: Cannot read stand fraction for %s stand.\n",stand->type->name);
-    free(stand);
+    releasestand(stand);
     return NULL;
   }
   stand->data=NULL;
@@ -85,6 +85,7 @@ void freeconfig(Config *config /**< LPJmL configuration */
       pnet_free(config->irrig_back);
     }
     pnet_free(config->route);
+    free(config->fin_local);
   }
   if(config->wateruse)
     freefilename(&config->wateruse_filename);
@@ -121,6 +122,10 @@ void freeconfig(Config *config /**< LPJmL configuration */
   free(config->restart_filename);
   free(config->checkpoint_restart_filename);
   free(config->write_restart_filename);
+  free(config->cost_filename);
+  free(config->write_cost_filename);
+  free(config->timing_filename);
+  free(config->cellcounts);
   free(config->cult_types);
   free(config->pfttypes);
   freepftpar(config->pftpar,ivec_sum(config->npft,config->ntypes));
@@ -141,34 +141,6 @@ static Bool readclimatefilename(LPJfile *file,Filename *name,const char *key,Boo
 } /* of 'readclimatefilename' */
 
 
-static void divide(int *start, /**< index of first grid cell */
-                   int *end,   /**< index of last grid cell */
-                   int rank,   /**< my rank id */
-                   int ntask   /**< total number of tasks */
-                  )
-{
-/*
- * Function is used in the parallel MPI version to distribute the cell grid
- * equally on ntask tasks
- * On return start and end are set to the local boundaries of each task
- */
-  int i,lo,hi,n;
-  n=*end-*start+1;
-  lo=*start;
-  hi=*start+n/ntask-1;
-  if(n % ntask)
-    hi++;
-  for(i=1;i<=rank;i++)
-  {
-    lo=hi+1;
-    hi=lo+n/ntask-1;
-    if(n % ntask>i)
-      hi++;
-  }
-  *start=lo;
-  *end=hi;
-} /* of 'divide' */
-
 static Bool checktimestep(const Config *config)
 {
   Bool rc;
@@ -220,6 +192,10 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
   char *tillage[]={"no","all","read"};
   char *residue_treatment[]={"no_residue_remove","fixed_residue_remove","read_residue_data"};
   char *population[]={"no","density","number"};
+  char *decomposition[]={"equal","cost","basin"};
+  char *lambda_solver[]={"bisect","illinois"};
+  char *store_climate_type[]={"double","float","short"};
+  Type store_types[]={LPJ_DOUBLE,LPJ_FLOAT,LPJ_SHORT};
   Bool def[N_IN];
   verbose=(isroot(*config)) ? config->scan_verbose : NO_ERR;
 
@@ -362,6 +338,9 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
   config->johansen = TRUE;
   if(fscanbool(file,&config->johansen,"johansen",!config->pedantic,verbose))
     return TRUE;
+  config->lambda_solver=BISECT_SOLVER;
+  if(fscankeywords(file,&config->lambda_solver,"lambda_solver",lambda_solver,2,TRUE,verbose))
+    return TRUE;
   if(fscankeywords(file,&config->with_dynamic_ch4,"methane",methane,3,FALSE,verbose))
     return TRUE;
   fscanbool2(file, &config->isanomaly, "anomaly");
@@ -415,6 +394,23 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
   config->storeclimate=TRUE;
   if(fscanbool(file,&config->storeclimate,"store_climate",!config->pedantic,verbose))
     return TRUE;
+  config->store_climate_type=LPJ_DOUBLE;
+  if(config->storeclimate && iskeydefined(file,"store_climate_type"))
+  {
+    if(fscankeywords(file,&i,"store_climate_type",store_climate_type,3,FALSE,verbose))
+      return TRUE;
+    config->store_climate_type=store_types[i];
+  }
+  config->readahead_climate=FALSE;
+  if(iskeydefined(file,"readahead_climate"))
+  {
+    fscanbool2(file,&config->readahead_climate,"readahead_climate");
+  }
+  config->mmap_climate=FALSE;
+  if(iskeydefined(file,"mmap_climate"))
+  {
+    fscanbool2(file,&config->mmap_climate,"mmap_climate");
+  }
   config->fix_climate=FALSE;
   if(fscanbool(file,&config->fix_climate,"fix_climate",!config->pedantic,verbose))
     return TRUE;
@@ -1072,6 +1068,49 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
     config->restartdir=strdup(name);
     checkptr(config->restartdir);
   }
+  config->decomposition=EQUAL_DECOMPOSITION;
+  config->cost_filename=NULL;
+  config->write_cost_filename=NULL;
+  config->cellcounts=NULL;
+  if(iskeydefined(file,"decomposition"))
+  {
+    if(fscankeywords(file,&config->decomposition,"decomposition",decomposition,3,FALSE,verbose))
+      return TRUE;
+  }
+  if(config->decomposition==BASIN_DECOMPOSITION && (!config->river_routing || config->drainage_filename.fmt==CDF))
+  {
+    if(verbose)
+      fprintf(stderr,"WARNING050: Basin decomposition needs river routing and drainage file not in NetCDF format, equal decomposition used.\n");
+    if(config->pedantic)
+      return TRUE;
+    config->decomposition=EQUAL_DECOMPOSITION;
+  }
+  if(config->decomposition==COST_DECOMPOSITION)
+  {
+    fscanname(file,name,"cost_filename");
+    config->cost_filename=addpath(name,config->inputdir);
+    checkptr(config->cost_filename);
+  }
+  if(iskeydefined(file,"write_cost_filename") && !isnull(file,"write_cost_filename"))
+  {
+    fscanname(file,name,"write_cost_filename");
+    config->write_cost_filename=addpath(name,config->restartdir);
+    checkptr(config->write_cost_filename);
+  }
+  config->timing_filename=NULL;
+  if(iskeydefined(file,"timing_filename") && !isnull(file,"timing_filename"))
+  {
+    fscanname(file,name,"timing_filename");
+#ifdef USE_TIMING
+    config->timing_filename=addpath(name,config->outputdir);
+    checkptr(config->timing_filename);
+#else
+    if(verbose)
+      fprintf(stderr,"WARNING055: Timing not supported in this version of LPJmL, timing report '%s' not written.\n",name);
+    if(config->pedantic)
+      return TRUE;
+#endif
+  }
   config->startgrid=ALL; /* set default value */
   if(isstring(file,"startgrid"))
   {
@@ -1130,14 +1169,57 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
                 config->nall,config->ntask);
       return TRUE;
     }
-    if(config->ntask>1) /* parallel mode? */
-      divide(&config->startgrid,&endgrid,config->rank,
-             config->ntask);
-    config->ngridcell=endgrid-config->startgrid+1;
+    config->cellcounts=newvec(int,config->ntask);
+    checkptr(config->cellcounts);
+    if(config->decomposition==COST_DECOMPOSITION)
+    {
+      /* distribute cells on tasks according to costs of previous run */
+      if(getcostcounts(config->cellcounts,config->cost_filename,config))
+        return TRUE;
+    }
+    else if(config->decomposition==BASIN_DECOMPOSITION)
+    {
+      /* shift task boundaries to positions crossed by fewer river connections */
+      if(getbasincounts(config->cellcounts,config))
+        return TRUE;
+    }
+    else
+      for(i=0;i<config->ntask;i++) /* distribute cells equally on tasks */
+        config->cellcounts[i]=config->nall/config->ntask+((i<config->nall % config->ntask) ? 1 : 0);
+    for(i=0;i<config->rank;i++)
+      config->startgrid+=config->cellcounts[i];
+    config->ngridcell=config->cellcounts[config->rank];
+  }
+#ifdef USE_OPENMP
+  config->nthreads=omp_get_max_threads();
+#else
+  config->nthreads=1;
+#endif
+  if(iskeydefined(file,"nthreads"))
+  {
+    fscanint2(file,&config->nthreads,"nthreads");
+    if(config->nthreads<1)
+    {
+      if(verbose)
+        fprintf(stderr,"ERROR270: Number of threads=%d must be greater than zero.\n",
+                config->nthreads);
+      return TRUE;
+    }
+  }
+#ifndef USE_OPENMP
+  if(config->nthreads>1)
+  {
+    if(verbose)
+      fprintf(stderr,"WARNING045: OpenMP not supported in this version of LPJmL, number of threads set to one.\n");
+    if(config->pedantic)
+      return TRUE;
+    config->nthreads=1;
   }
+#endif
   fscanint2(file,&config->nspinup,"nspinup");
   config->isfirstspinupyear=FALSE;
   config->shuffle_spinup_climate=FALSE;
+  config->spinup_convergence=FALSE;
   if(config->nspinup || config->isanomaly)
   {
     if(config->nspinup<0)
@@ -1162,6 +1244,34 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
       fscanint2(file,&config->firstspinupyear,"firstspinupyear");
       config->isfirstspinupyear=TRUE;
     }
+    if(config->nspinup)
+    {
+      if(fscanbool(file,&config->spinup_convergence,"spinup_convergence",TRUE,verbose))
+        return TRUE;
+    }
+    if(config->spinup_convergence)
+    {
+      config->spinup_window=config->nspinyear;
+      if(fscanint(file,&config->spinup_window,"spinup_window",TRUE,verbose))
+        return TRUE;
+      if(config->spinup_window<1)
+      {
+        if(verbose)
+          fprintf(stderr,"ERROR273: Window length of spinup convergence check (\"spinup_window\")=%d must be greater than zero.\n",
+                  config->spinup_window);
+        return TRUE;
+      }
+      config->spinup_tolerance=1e-3;
+      if(fscanreal(file,&config->spinup_tolerance,"spinup_tolerance",TRUE,verbose))
+        return TRUE;
+      if(config->spinup_tolerance<=0)
+      {
+        if(verbose)
+          fprintf(stderr,"ERROR274: Tolerance of spinup convergence check (\"spinup_tolerance\")=%g must be greater than zero.\n",
+                  config->spinup_tolerance);
+        return TRUE;
+      }
+    }
   }
   fscanint2(file,&config->firstyear,"firstyear");
   fscanint2(file,&config->lastyear,"lastyear");
@@ -1212,6 +1322,13 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
   }
   else
     config->outputyear=config->firstyear;
+  if(config->spinup_convergence && config->outputyear<config->firstyear)
+  {
+    if(verbose)
+      fprintf(stderr,"WARNING051: Output is written in spinup, output of spinup years after convergence is missing.\n");
+    if(config->pedantic)
+      return TRUE;
+  }
   if(checktimestep(config) && config->pedantic)
     return TRUE;
   config->baseyear=config->outputyear;
@@ -1234,6 +1351,36 @@ Bool fscanconfig(Config *config,    /**< LPJ configuration */
   {
     config->restart_filename=NULL;
   }
+  config->fast_restart=FALSE;
+  if(iskeydefined(file,"fast_restart"))
+  {
+    fscanbool2(file,&config->fast_restart,"fast_restart");
+  }
+  config->mmap_restart=FALSE;
+  if(iskeydefined(file,"mmap_restart"))
+  {
+    fscanbool2(file,&config->mmap_restart,"mmap_restart");
+  }
+  config->restart_compression=0;
+  if(iskeydefined(file,"restart_compression"))
+  {
+    fscanint2(file,&config->restart_compression,"restart_compression");
+    if(config->restart_compression<0 || config->restart_compression>9)
+    {
+      if(verbose)
+        fprintf(stderr,"ERROR275: Invalid value %d for restart compression level, must be in [0,9].\n",
+                config->restart_compression);
+      return TRUE;
+    }
+#ifndef USE_ZLIB
+    if(config->restart_compression)
+    {
+      if(verbose)
+        fprintf(stderr,"WARNING053: LPJmL not compiled with zlib support, restart files are not compressed.\n");
+      config->restart_compression=0;
+    }
+#endif
+  }
   fscanbool2(file,&config->equilsoil,"equilsoil");
   if(iskeydefined(file,"checkpoint_filename") && !isnull(file,"checkpoint_filename"))
   {
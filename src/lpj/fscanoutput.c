@@ -225,6 +225,29 @@ Bool fscanoutput(LPJfile *file,  /**< pointer to LPJ file */
     free(default_suffix);
     return TRUE;
   }
+  config->parallel_output=FALSE;
+  if(iskeydefined(file,"parallel_output"))
+  {
+    fscanbool2(file,&config->parallel_output,"parallel_output");
+  }
+  config->async_output=FALSE;
+  if(iskeydefined(file,"async_output"))
+  {
+    fscanbool2(file,&config->async_output,"async_output");
+#ifndef USE_PTHREAD
+    if(config->async_output)
+    {
+      if(verbosity)
+        fprintf(stderr,"WARNING047: Asynchronous output not supported in this version of LPJmL, output is written synchronously.\n");
+      if(config->pedantic)
+      {
+        free(default_suffix);
+        return TRUE;
+      }
+      config->async_output=FALSE;
+    }
+#endif
+  }
   config->grid_type=LPJ_SHORT;
   if(iskeydefined(file,"float_grid"))
   {
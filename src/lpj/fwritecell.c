@@ -32,7 +32,7 @@ int fwritecell(Bstruct file,      /**< pointer to restart file */
   {
     if(index!=NULL)
       index[cell]=bstruct_getarrayindex(file); /* store actual position in index vector */
-    bstruct_writebeginstruct(file,NULL);
+    bstruct_writebeginzstruct(file);
     bstruct_writecoord(file,"coord",&grid[cell].coord);
     bstruct_writebool(file,"skip",grid[cell].skip);
     fwriteseed(file,"seed",grid[cell].seed);
@@ -124,7 +124,7 @@ int fwritecell(Bstruct file,      /**< pointer to restart file */
       if(ischeckpoint && config->n_out)
         fwriteoutputdata(file,"outputdata",&grid[cell].output,config);
     }
-    bstruct_writeendstruct(file);
+    bstruct_writeendzstruct(file);
   } /* of 'for(cell=...)' */
   return cell;
 } /* of 'fwritecell' */
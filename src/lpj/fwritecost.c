@@ -0,0 +1,95 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              f  w  r  i  t  e  c  o  s  t  .  c                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function writes measured cost of each grid cell to binary file             \n**/
+/**     to be used for the domain decomposition in subsequent runs                 \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+Bool fwritecost(const Cell grid[],    /**< LPJ grid */
+                const char *filename, /**< filename of cost file */
+                const Config *config  /**< LPJmL configuration */
+               )                      /** \return TRUE on error */
+{
+  FILE *file;
+  Header header;
+  float *vec,*all;
+  Bool rc;
+  int cell;
+#ifdef USE_MPI
+  int *counts,*offsets;
+#endif
+  vec=newvec(float,config->ngridcell);
+  check(vec);
+  for(cell=0;cell<config->ngridcell;cell++)
+    vec[cell]=(float)grid[cell].cost;
+#ifdef USE_MPI
+  all=NULL;
+  if(isroot(*config))
+  {
+    all=newvec(float,config->nall);
+    check(all);
+  }
+  counts=newvec(int,config->ntask);
+  check(counts);
+  offsets=newvec(int,config->ntask);
+  check(offsets);
+  getgridcounts(counts,offsets,1,config);
+  MPI_Gatherv(vec,config->ngridcell,MPI_FLOAT,all,counts,offsets,
+              MPI_FLOAT,0,config->comm);
+  free(counts);
+  free(offsets);
+  free(vec);
+#else
+  all=vec;
+#endif
+  rc=FALSE;
+  if(isroot(*config))
+  {
+    file=fopen(filename,"wb");
+    if(file==NULL)
+    {
+      printfopenerr(filename);
+      rc=TRUE;
+    }
+    else
+    {
+      header.order=CELLYEAR;
+      header.firstyear=config->lastyear;
+      header.nyear=1;
+      header.firstcell=config->firstgrid;
+      header.ncell=config->nall;
+      header.nbands=1;
+      header.nstep=1;
+      header.timestep=1;
+      header.cellsize_lon=(float)config->resolution.lon;
+      header.cellsize_lat=(float)config->resolution.lat;
+      header.scalar=1;
+      header.datatype=LPJ_FLOAT;
+      fwriteheader(file,&header,LPJ_COST_HEADER,LPJ_COST_VERSION);
+      if(fwrite(all,sizeof(float),config->nall,file)!=config->nall)
+      {
+        fprintf(stderr,"ERROR204: Cannot write cost data to '%s': %s.\n",
+                filename,strerror(errno));
+        rc=TRUE;
+      }
+      fclose(file);
+    }
+  }
+  free(all);
+#ifdef USE_MPI
+  MPI_Bcast(&rc,1,MPI_INT,0,config->comm);
+#endif
+  return rc;
+} /* of 'fwritecost' */
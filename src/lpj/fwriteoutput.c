@@ -19,17 +19,28 @@
 #include "tree.h"
 #include "agriculture.h"
 
+#ifdef USE_MPI
+#define isqueued(output,index) (output->files[index].isopen && output->isasync && !output->files[index].isparallel)
+#else
+#define isqueued(output,index) (output->files[index].isopen && output->queue!=NULL)
+#endif
+#define getfile(output,index) ((output->files[index].fmt==CDF) ? NULL : output->files[index].fp.file)
+#define getcdf(output,index) ((output->files[index].fmt==CDF) ? &output->files[index].fp.cdf : NULL)
+
 static void flush_output(Outputfile *output,int index)
 {
-  switch(output->files[index].fmt)
-  {
-    case RAW: case CLM: case TXT:
-      fflush(output->files[index].fp.file);
-      break;
-    case CDF:
-      flush_netcdf(&output->files[index].fp.cdf);
-      break;
-  }
+  if(!output->files[index].isopen)
+    return;
+#ifdef USE_MPI
+  if(output->files[index].isparallel)
+    return;
+#endif
+  if(output->queue!=NULL)
+    putflushqueue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index));
+  else if(output->files[index].fmt==CDF)
+    flush_netcdf(&output->files[index].fp.cdf);
+  else
+    fflush(output->files[index].fp.file);
 }
 
 #define iswrite(output,index) (isopen(output,index) && iswrite2(index,timestep,year,config))
@@ -138,36 +149,53 @@ static Real getscale(int date,int ndata,int timestep,Time time)
   return scale;
 } /* of 'getscale' */
 
+static int getcdfindex(const Outputfile *output,int index,int year,int date,int ndata,
+                       Bool istimestep,const Config *config)
+{
+  if(output->files[index].oneyear)
+    return (config->outnames[index].timestep==ANNUAL) ? NO_TIME : date;
+  if(istimestep && config->outnames[index].timestep>0)
+    return (year-config->outputyear)/config->outnames[index].timestep;
+  return (year-config->outputyear)*ndata+date;
+} /* of 'getcdfindex' */
+
 static Bool writedata(Outputfile *output,int index,float data[],int year,int date,int ndata,
                       const Config *config)
 {
   Real scale;
   int i,offset,rc=FALSE;
-  scale=getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
-  for(i=0;i<config->count;i++)
-    data[i]=(float)(config->outnames[index].scale*scale*data[i]+config->outnames[index].offset);
+  scale=config->outnames[index].scale*getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
+  offset=getcdfindex(output,index,year,date,ndata,TRUE,config);
+  /* data are scaled by writer thread if queued */
+#ifdef USE_MPI
+  if(isqueued(output,index))
+    rc=mpi_write_queue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                       data,MPI_FLOAT,config->total,scale,config->outnames[index].offset,offset,-1,
+                       output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
+#else
+  if(isqueued(output,index))
+    rc=putwritequeue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                     LPJ_FLOAT,data,config->count,scale,config->outnames[index].offset,offset,-1,
+                     config->csv_delimit);
+#endif
+  if(rc)
+    return TRUE;
+  if(!isqueued(output,index) || output->files[index].issocket)
+    for(i=0;i<config->count;i++)
+      data[i]=(float)(scale*data[i]+config->outnames[index].offset);
 #ifdef USE_MPI
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        rc=mpi_write(output->files[index].fp.file,data,MPI_FLOAT,config->total,
-                     output->counts,output->offsets,config->rank,config->comm);
+        rc=mpi_write_file(output->files+index,data,MPI_FLOAT,config->total,
+                          output->counts,output->offsets,config->rank,config->comm);
         break;
       case TXT:
         rc=mpi_write_txt(output->files[index].fp.file,data,MPI_FLOAT,config->total,
                          output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=mpi_write_netcdf(&output->files[index].fp.cdf,data,MPI_FLOAT,config->total,
                             offset,
                             output->counts,output->offsets,config->rank,config->comm);
@@ -182,7 +210,7 @@ static Bool writedata(Outputfile *output,int index,float data[],int year,int dat
                      output->counts,output->offsets,config->rank,config->comm);
   }
 #else
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
@@ -198,15 +226,6 @@ static Bool writedata(Outputfile *output,int index,float data[],int year,int dat
         fprintf(output->files[index].fp.file,"%g\n",data[config->count-1]);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=write_float_netcdf(&output->files[index].fp.cdf,data,
                               offset,
                               config->count);
@@ -227,28 +246,24 @@ static Bool writeshortdata(Outputfile *output,int index,short data[],int year,in
                            const Config *config)
 {
   int rc=FALSE,offset;
+  offset=getcdfindex(output,index,year,date,ndata,TRUE,config);
 #ifdef USE_MPI
-  if(output->files[index].isopen)
+  if(isqueued(output,index))
+    rc=mpi_write_queue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                       data,MPI_SHORT,config->total,1,0,offset,-1,
+                       output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
+  else if(output->files[index].isopen)
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        rc=mpi_write(output->files[index].fp.file,data,MPI_SHORT,config->total,
-                     output->counts,output->offsets,config->rank,config->comm);
+        rc=mpi_write_file(output->files+index,data,MPI_SHORT,config->total,
+                          output->counts,output->offsets,config->rank,config->comm);
         break;
       case TXT:
         rc=mpi_write_txt(output->files[index].fp.file,data,MPI_SHORT,config->total,
                          output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=mpi_write_netcdf(&output->files[index].fp.cdf,data,MPI_SHORT,config->total,
                             offset,
                             output->counts,output->offsets,config->rank,config->comm);
@@ -264,7 +279,10 @@ static Bool writeshortdata(Outputfile *output,int index,short data[],int year,in
   }
 #else
   int i;
-  if(output->files[index].isopen)
+  if(isqueued(output,index))
+    rc=putwritequeue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                     LPJ_SHORT,data,config->count,1,0,offset,-1,config->csv_delimit);
+  else if(output->files[index].isopen)
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
@@ -280,15 +298,6 @@ static Bool writeshortdata(Outputfile *output,int index,short data[],int year,in
         fprintf(output->files[index].fp.file,"%d\n",data[config->count-1]);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=write_short_netcdf(&output->files[index].fp.cdf,data,
                               offset,
                               config->count);
@@ -313,44 +322,46 @@ static Bool writealldata(Outputfile *output,int index,float data[],int year,int
 #ifdef USE_MPI
   int *counts,*offsets;
 #endif
-  scale=getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
-  for(i=0;i<config->ngridcell;i++)
-    data[i]=(float)(config->outnames[index].scale*scale*data[i]+config->outnames[index].offset);
+  scale=config->outnames[index].scale*getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
+  offset=getcdfindex(output,index,year,date,ndata,FALSE,config);
 #ifdef USE_MPI
   counts=newvec(int,config->ntask);
   check(counts);
   offsets=newvec(int,config->ntask);
   check(offsets);
-  getcounts(counts,offsets,config->nall,1,config->ntask);
-  if(output->files[index].isopen)
+  getgridcounts(counts,offsets,1,config);
+  if(isqueued(output,index))
+    rc=mpi_write_queue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                       data,MPI_FLOAT,config->nall,scale,config->outnames[index].offset,offset,-1,
+                       counts,offsets,config->rank,config->csv_delimit,config->comm);
+#else
+  if(isqueued(output,index))
+    rc=putwritequeue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                     LPJ_FLOAT,data,config->ngridcell,scale,config->outnames[index].offset,offset,-1,
+                     config->csv_delimit);
+#endif
+  if(!rc && (!isqueued(output,index) || output->files[index].issocket))
+    for(i=0;i<config->ngridcell;i++)
+      data[i]=(float)(scale*data[i]+config->outnames[index].offset);
+#ifdef USE_MPI
+  if(!rc && output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        rc=mpi_write(output->files[index].fp.file,data,MPI_FLOAT,config->nall,counts,
-                     offsets,config->rank,config->comm);
+        rc=mpi_write_file(output->files+index,data,MPI_FLOAT,config->nall,counts,
+                          offsets,config->rank,config->comm);
         break;
       case TXT:
         rc=mpi_write_txt(output->files[index].fp.file,data,MPI_FLOAT,config->nall,counts,
                          offsets,config->rank,config->csv_delimit,config->comm);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(year-config->outputyear)*ndata+date;
         rc=mpi_write_netcdf(&output->files[index].fp.cdf,data,MPI_FLOAT,config->nall,
                             offset,
                             counts,offsets,config->rank,config->comm);
         break;
     }
-  if(rc)
-    return TRUE;
-  if(output->files[index].issocket)
+  if(!rc && output->files[index].issocket)
   {
     send_output_coupler(index,year,date,config);
     rc=mpi_write_socket(config->socket,data,MPI_FLOAT,config->nall,counts,
@@ -359,7 +370,7 @@ static Bool writealldata(Outputfile *output,int index,float data[],int year,int
   free(counts);
   free(offsets);
 #else
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
@@ -375,15 +386,6 @@ static Bool writealldata(Outputfile *output,int index,float data[],int year,int
         fprintf(output->files[index].fp.file,"%g\n",data[config->ngridcell-1]);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(year-config->outputyear)*ndata+date;
         rc=write_float_netcdf(&output->files[index].fp.cdf,data,
                               offset,
                               config->ngridcell);
@@ -405,31 +407,36 @@ static Bool writepft(Outputfile *output,int index,float *data,int year,
 {
   Real scale;
   int i,offset,rc=FALSE;
-  scale=getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
-  for(i=0;i<config->count;i++)
-    data[i]=(float)(config->outnames[index].scale*scale*data[i]+config->outnames[index].offset);
+  scale=config->outnames[index].scale*getscale(date,ndata,(config->outnames[index].timestep==ANNUAL) ? 1 : config->outnames[index].timestep,config->outnames[index].time);
+  offset=getcdfindex(output,index,year,date,ndata,TRUE,config);
+#ifdef USE_MPI
+  if(isqueued(output,index))
+    rc=mpi_write_queue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                       data,MPI_FLOAT,config->total,scale,config->outnames[index].offset,offset,layer,
+                       output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
+#else
+  if(isqueued(output,index))
+    rc=putwritequeue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                     LPJ_FLOAT,data,config->count,scale,config->outnames[index].offset,offset,layer,' ');
+#endif
+  if(rc)
+    return TRUE;
+  if(!isqueued(output,index) || output->files[index].issocket)
+    for(i=0;i<config->count;i++)
+      data[i]=(float)(scale*data[i]+config->outnames[index].offset);
 #ifdef USE_MPI
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        rc=mpi_write(output->files[index].fp.file,data,MPI_FLOAT,config->total,
-                     output->counts,output->offsets,config->rank,config->comm);
+        rc=mpi_write_file(output->files+index,data,MPI_FLOAT,config->total,
+                          output->counts,output->offsets,config->rank,config->comm);
         break;
       case TXT:
         rc=mpi_write_txt(output->files[index].fp.file,data,MPI_FLOAT,config->total,
                          output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=mpi_write_pft_netcdf(&output->files[index].fp.cdf,data,MPI_FLOAT,
                                 config->total,offset,layer,
                                 output->counts,output->offsets,config->rank,
@@ -444,7 +451,7 @@ static Bool writepft(Outputfile *output,int index,float *data,int year,
                         output->counts,output->offsets,config->rank,config->comm);
   }
 #else
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
@@ -460,15 +467,6 @@ static Bool writepft(Outputfile *output,int index,float *data,int year,
         fprintf(output->files[index].fp.file,"%g\n",data[config->count-1]);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(config->outnames[index].timestep>0) ? (year-config->outputyear)/config->outnames[index].timestep : (year-config->outputyear)*ndata+date;
         rc=write_pft_float_netcdf(&output->files[index].fp.cdf,data,
                                   offset,layer,config->count);
         break;
@@ -485,30 +483,36 @@ static Bool writeshortpft(Outputfile *output,int index,short *data,int year,
                           int date,int ndata,int layer,const Config *config)
 {
   int i,offset,rc=FALSE;
-  for(i=0;i<config->count;i++)
-    data[i]=(short)(config->outnames[index].scale*data[i]+config->outnames[index].offset);
+  offset=getcdfindex(output,index,year,date,ndata,FALSE,config);
 #ifdef USE_MPI
-  if(output->files[index].isopen)
+  if(isqueued(output,index))
+    rc=mpi_write_queue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                       data,MPI_SHORT,config->total,config->outnames[index].scale,config->outnames[index].offset,offset,layer,
+                       output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
+#else
+  if(isqueued(output,index))
+    rc=putwritequeue(output->queue,output->files[index].fmt,getfile(output,index),getcdf(output,index),
+                     LPJ_SHORT,data,config->count,config->outnames[index].scale,config->outnames[index].offset,offset,layer,
+                     config->csv_delimit);
+#endif
+  if(rc)
+    return TRUE;
+  if(!isqueued(output,index) || output->files[index].issocket)
+    for(i=0;i<config->count;i++)
+      data[i]=(short)(config->outnames[index].scale*data[i]+config->outnames[index].offset);
+#ifdef USE_MPI
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        rc=mpi_write(output->files[index].fp.file,data,MPI_SHORT,config->total,
-                     output->counts,output->offsets,config->rank,config->comm);
+        rc=mpi_write_file(output->files+index,data,MPI_SHORT,config->total,
+                          output->counts,output->offsets,config->rank,config->comm);
         break;
       case TXT:
         rc=mpi_write_txt(output->files[index].fp.file,data,MPI_SHORT,config->total,
                          output->counts,output->offsets,config->rank,config->csv_delimit,config->comm);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(year-config->outputyear)*ndata+date;
         rc=mpi_write_pft_netcdf(&output->files[index].fp.cdf,data,MPI_SHORT,
                                 config->total,offset,layer,
                                 output->counts,output->offsets,config->rank,
@@ -521,7 +525,7 @@ static Bool writeshortpft(Outputfile *output,int index,short *data,int year,
     rc=mpi_write_socket(config->socket,data,MPI_SHORT,config->total,
                         output->counts,output->offsets,config->rank,config->comm);
 #else
-  if(output->files[index].isopen)
+  if(output->files[index].isopen && !isqueued(output,index))
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
@@ -537,15 +541,6 @@ static Bool writeshortpft(Outputfile *output,int index,short *data,int year,
         fprintf(output->files[index].fp.file,"%d\n",data[config->count-1]);
         break;
       case CDF:
-        if(output->files[index].oneyear)
-        {
-          if(config->outnames[index].timestep==ANNUAL)
-            offset=NO_TIME;
-          else
-            offset=date;
-        }
-        else
-          offset=(year-config->outputyear)*ndata+date;
         rc=write_pft_short_netcdf(&output->files[index].fp.cdf,data,
                                   offset,layer,config->count);
         break;
@@ -581,7 +576,7 @@ Bool fwriteoutput(Outputfile *output,  /**< output file array */
 
 #ifdef USE_TIMING
   double t;
-  timing_start(t);
+  timing_start(FWRITEOUTPUT_FCN,t);
 #endif
   nirrig=2*getnirrig(ncft,config);
   nnat=getnnat(npft,config);
@@ -47,6 +47,7 @@ Bool fwritepft(Bstruct file,  /**< File pointer to binary file */
   bstruct_writereal(file,"albedo",pft->albedo);
   bstruct_writereal(file,"fapar",pft->fapar);
   bstruct_writereal(file,"nleaf",pft->nleaf);
+  bstruct_writereal(file,"lambda",pft->lambda);
   fwritestocks(file,"establish",&pft->establish);
   return bstruct_writeendstruct(file);
 } /* of 'fwritepft' */
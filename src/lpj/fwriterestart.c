@@ -5,6 +5,8 @@
 /**     C implementation of LPJmL                                                  \n**/
 /**                                                                                \n**/
 /**     Functions writes restart/checkpoint file.                                  \n**/
+/**     In the MPI version all tasks serialize their cells into memory and         \n**/
+/**     write their blocks concurrently at offsets computed by MPI_Exscan().       \n**/
 /**                                                                                \n**/
 /** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
 /** authors, and contributors see AUTHORS file                                     \n**/
@@ -16,7 +18,251 @@
 
 #include "lpj.h"
 
-#define MSGTAG 101 /* MPI message tag */
+static void writeheader(Bstruct file,        /**< pointer to restart file */
+                        int npft,            /**< number of natural PFTs */
+                        int ncft,            /**< number of crop PFTs */
+                        int year,            /**< year */
+                        const Config *config /**< LPJ configuration */
+                       )
+{
+  char *s;
+  time_t t;
+  int p;
+  /* write header in restart file */
+  bstruct_writebeginstruct(file,"header");
+  bstruct_writestring(file,"version",getversion());
+  bstruct_writestring(file,"sim_name",config->sim_name);
+  time(&t);
+  s=getsprintf("%s: %s",strdate(&t),config->arglist);
+  bstruct_writestring(file,"history",s);
+  free(s);
+  bstruct_writebeginstruct(file,"global_attrs");
+  bstruct_writestring(file,"GIT_repo",getrepo());
+  bstruct_writestring(file,"GIT_hash",gethash());
+  /* write global attributes */
+  for(p=0;p<config->n_global;p++)
+  {
+    bstruct_writestring(file,config->global_attrs[p].name,config->global_attrs[p].value);
+  }
+  bstruct_writeendstruct(file);
+  bstruct_writeint(file,"year",year);
+  bstruct_writeint(file,"firstcell",config->startgrid);
+  bstruct_writeint(file,"npft",npft);
+  bstruct_writeint(file,"ncft",ncft);
+  bstruct_writereal(file,"cellsize_lat",config->resolution.lat);
+  bstruct_writereal(file,"cellsize_lon",config->resolution.lon);
+  bstruct_writeint(file,"datatype",(sizeof(Real)==sizeof(float)) ? LPJ_FLOAT : LPJ_DOUBLE);
+  bstruct_writebool(file,"landuse",(config->withlanduse!=NO_LANDUSE));
+  bstruct_writeint(file,"sdate_option",config->sdate_option);
+  bstruct_writebool(file,"crop_phu_option",config->crop_phu_option>=PRESCRIBED_CROP_PHU);
+  bstruct_writebool(file,"river_routing",config->river_routing);
+  bstruct_writebool(file,"separate_harvests",config->separate_harvests);
+  /* write array of all PFT names */
+  bstruct_writebeginarray(file,"pfts",npft+ncft);
+  for(p=0;p<npft+ncft;p++)
+    bstruct_writestring(file,NULL,config->pftpar[p].name);
+  bstruct_writeendarray(file);
+  fwriteseed(file,"seed",config->seed);
+  bstruct_writeendstruct(file);
+} /* of 'writeheader' */
+
+static Bool writecells(Bstruct file,        /**< pointer to restart file */
+                       long long index[],   /**< [out] position of each cell */
+                       long long *filepos,  /**< [out] position of index vector (only root task) */
+                       long long *start,    /**< [out] position of first cell */
+                       const Cell grid[],   /**< cell array */
+                       int npft,            /**< number of natural PFTs */
+                       int ncft,            /**< number of crop PFTs */
+                       int year,            /**< year */
+                       Bool ischeckpoint,   /**< file is checkpoint file */
+                       const Config *config /**< LPJ configuration */
+                      )                     /** \return TRUE on error */
+{
+  /* header is written on all tasks, so that names of header get the same
+   * ids on all tasks. Data before first cell are only kept on root task */
+  writeheader(file,npft,ncft,year,config);
+  if(isroot(*config))
+    /* define array with index vector and get position of first element of index vector */
+    bstruct_writebeginindexarray(file,"grid",filepos,config->nall);
+  else
+    bstruct_writebeginarray(file,"grid",config->ngridcell);
+  *start=(isroot(*config)) ? 0 : bstruct_getarrayindex(file);
+  /* write cell data and get index vector */
+  if(fwritecell(file,index,grid,config->ngridcell,ncft,npft,ischeckpoint,config)!=config->ngridcell)
+    return TRUE;
+  if(config->rank==config->ntask-1)
+    bstruct_writeendarray(file);
+  return FALSE;
+} /* of 'writecells' */
+
+#ifdef USE_MPI
+
+static Bool writeblock(MPI_File fh,       /**< MPI file handle */
+                       MPI_Offset offset, /**< file offset (bytes) */
+                       const void *data,  /**< data to write */
+                       size_t size        /**< size of data (bytes) */
+                      )                   /** \return TRUE on error */
+{
+  MPI_Status status;
+  const char *ptr;
+  int n;
+  ptr=data;
+  while(size>0)
+  {
+    /* MPI counts are limited to int */
+    n=(size>INT_MAX) ? INT_MAX : size;
+    if(MPI_File_write_at(fh,offset,(void *)ptr,n,MPI_BYTE,&status)!=MPI_SUCCESS)
+      return TRUE;
+    offset+=n;
+    ptr+=n;
+    size-=n;
+  }
+  return FALSE;
+} /* of 'writeblock' */
+
+static Bool issameid(const Hash local, /**< hash of names of task */
+                     Hash global       /**< hash of names of all tasks */
+                    )                  /** \return TRUE if ids of all names are the same */
+{
+  Hashitem *items;
+  int i,count;
+  Bool same=TRUE;
+  count=gethashcount(local);
+  items=hash2array(local);
+  check(items);
+  for(i=0;i<count;i++)
+    if(*((short *)items[i].data)!=*((short *)gethashitem(global,items[i].key)))
+    {
+      same=FALSE;
+      break;
+    }
+  free(items);
+  return same;
+} /* of 'issameid' */
+
+static Bool mpi_writerestart(const Cell grid[],   /**< cell array               */
+                             int npft,            /**< number of natural PFTs   */
+                             int ncft,            /**< number of crop PFTs      */
+                             int year,            /**< year                     */
+                             const char *filename,/**< filename of restart file */
+                             Bool ischeckpoint,   /**< file is checkpoint file  */
+                             const Config *config /**< LPJ configuration        */
+                            )                     /** \return TRUE on error     */
+{
+  MPI_File fh;
+  Bstruct file,mem,mem2;
+  long long *index; /* index vector storing file position of each LPJ cell */
+  long long filepos; /* position of first element of index vector in memory of root task */
+  long long base,offset,size,total,start;
+  const char *buffer;
+  size_t bufsize;
+  int cell;
+  Bool rc;
+  file=NULL;
+  base=filepos=total=0;
+  if(isroot(*config))
+  {
+    /* create restart file with file header, name table is written at the end */
+    file=bstruct_create(filename);
+    if(file!=NULL)
+    {
+      base=ftell(bstruct_getfile(file));
+      bstruct_sync(file);
+    }
+  }
+  mem=bstruct_memopen(TRUE);
+  mem2=(isroot(*config)) ? NULL : bstruct_memopen(TRUE);
+  rc=(mem==NULL || (isroot(*config) && file==NULL) || (!isroot(*config) && mem2==NULL));
+  if(iserror(rc,config))
+  {
+    bstruct_finish(file);
+    bstruct_finish(mem);
+    bstruct_finish(mem2);
+    return TRUE;
+  }
+  /* cell data are compressed in memory of each task */
+  bstruct_setcompress(mem,config->restart_compression);
+  if(mem2!=NULL)
+    bstruct_setcompress(mem2,config->restart_compression);
+  MPI_Bcast(&base,1,MPI_LONG_LONG,0,config->comm);
+  index=newvec(long long,config->ngridcell);
+  check(index);
+  /* serialize cells into memory, names used are collected in hash */
+  rc=writecells(mem,index,&filepos,&start,grid,npft,ncft,year,ischeckpoint,config);
+  if(rc)
+    fprintf(stderr,"ERROR153: Cannot write data in restart file '%s': %s\n",
+            filename,strerror(errno));
+  if(iserror(rc,config))
+  {
+    free(index);
+    bstruct_finish(file);
+    bstruct_finish(mem);
+    bstruct_finish(mem2);
+    return TRUE;
+  }
+  /* merge names of all tasks, names of root task keep their ids */
+  mergehash(bstruct_gethash((isroot(*config)) ? file : mem2),bstruct_gethash(mem),config->comm);
+  if(!isroot(*config))
+  {
+    if(issameid(bstruct_gethash(mem),bstruct_gethash(mem2)))
+      bstruct_finish(mem2);
+    else
+    {
+      /* cells use names in different order than root task, serialize cells again */
+      bstruct_finish(mem);
+      mem=mem2;
+      rc=writecells(mem,index,&filepos,&start,grid,npft,ncft,year,ischeckpoint,config);
+    }
+  }
+  /* skip header data on all tasks except root task */
+  buffer=bstruct_getbuffer(mem,&bufsize)+start;
+  bufsize-=start;
+  size=bufsize;
+  /* get file offset of data of each task */
+  offset=0;
+  MPI_Exscan(&size,&offset,1,MPI_LONG_LONG,MPI_SUM,config->comm);
+  if(isroot(*config))
+    offset=0;
+  offset+=base;
+  MPI_Reduce(&size,&total,1,MPI_LONG_LONG,MPI_SUM,0,config->comm);
+  MPI_Bcast(&filepos,1,MPI_LONG_LONG,0,config->comm);
+  filepos+=base;
+  for(cell=0;cell<config->ngridcell;cell++)
+    index[cell]+=offset-start;
+  /* all tasks write their data and their part of index vector concurrently */
+  if(MPI_File_open(config->comm,(char *)filename,MPI_MODE_WRONLY,MPI_INFO_NULL,&fh)!=MPI_SUCCESS)
+    rc=TRUE;
+  else
+  {
+    if(!rc)
+      rc=writeblock(fh,offset,buffer,bufsize);
+    /* data of root task contain index vector initialized with zeros, wait until all data are written */
+    MPI_File_sync(fh);
+    MPI_Barrier(config->comm);
+    MPI_File_sync(fh);
+    if(!rc)
+      rc=writeblock(fh,filepos+sizeof(long long)*(config->startgrid-config->firstgrid),
+                    index,sizeof(long long)*config->ngridcell);
+    MPI_File_close(&fh);
+  }
+  if(rc)
+    fprintf(stderr,"ERROR153: Cannot write data in restart file '%s'.\n",
+            filename);
+  free(index);
+  bstruct_freehash(mem);
+  bstruct_finish(mem);
+  rc=iserror(rc,config);
+  if(isroot(*config))
+  {
+    /* write name table after data of all tasks */
+    fseek(bstruct_getfile(file),base+total,SEEK_SET);
+    if(bstruct_finish(file))
+      rc=TRUE;
+  }
+  return rc;
+} /* of 'mpi_writerestart' */
+
+#endif
 
 Bool fwriterestart(const Cell grid[],   /**< cell array               */
                    int npft,            /**< number of natural PFTs   */
@@ -27,134 +273,35 @@ Bool fwriterestart(const Cell grid[],   /**< cell array               */
                    const Config *config /**< LPJ configuration        */
                   )                     /** \return TRUE on error     */
 {
-#ifdef USE_MPI
-  MPI_Status status;
-  Bool iserror;
-#endif
   Bstruct file;
-  char *s;
   long long *index;  /* index vector storing file position of each LPJ cell */
   long long filepos; /* position of first element of index vector in restart file */
-  time_t t;
-  int p;
-  if(isroot(*config))
-  {
-    /* create restart file */
-    file=bstruct_create(filename);
-  }
-  else
-  {
-#ifdef USE_MPI
-    /* wait until previous task has finished work */
-    MPI_Recv(&iserror,1,MPI_INT,config->rank-1,MSGTAG,config->comm,&status);
-    if(iserror)
-    {
-      if(config->rank<config->ntask-1)
-        MPI_Send(&iserror,1,MPI_INT,config->rank+1,MSGTAG,config->comm);
-      return TRUE;
-    }
-    /* get file position of index vector */
-    MPI_Recv(&filepos,1,MPI_LONG,config->rank-1,MSGTAG,config->comm,&status);
-#endif
-    /* append file */
-    file=bstruct_append(filename,TRUE);
+  long long start;
 #ifdef USE_MPI
-    receivehash(bstruct_gethash(file),config->rank-1,config->comm);
+  if(config->ntask>1)
+    return mpi_writerestart(grid,npft,ncft,year,filename,ischeckpoint,config);
 #endif
-  }
+  /* create restart file */
+  file=bstruct_create(filename);
   if(file==NULL)
   {
     printfcreateerr(filename);
-#ifdef USE_MPI
-    iserror=TRUE;
-    if(config->rank<config->ntask-1)
-      MPI_Send(&iserror,1,MPI_INT,config->rank+1,MSGTAG,config->comm);
-#endif
     return TRUE;
   }
-  if(isroot(*config))
-  {
-    /* write header in restart file */
-    bstruct_writebeginstruct(file,"header");
-    bstruct_writestring(file,"version",getversion());
-    bstruct_writestring(file,"sim_name",config->sim_name);
-    time(&t);
-    s=getsprintf("%s: %s",strdate(&t),config->arglist);
-    bstruct_writestring(file,"history",s);
-    free(s);
-    bstruct_writebeginstruct(file,"global_attrs");
-    bstruct_writestring(file,"GIT_repo",getrepo());
-    bstruct_writestring(file,"GIT_hash",gethash());
-    /* write global attributes */
-    for(p=0;p<config->n_global;p++)
-    {
-      bstruct_writestring(file,config->global_attrs[p].name,config->global_attrs[p].value);
-    }
-    bstruct_writeendstruct(file);
-    bstruct_writeint(file,"year",year);
-    bstruct_writeint(file,"firstcell",config->startgrid);
-    bstruct_writeint(file,"npft",npft);
-    bstruct_writeint(file,"ncft",ncft);
-    bstruct_writereal(file,"cellsize_lat",config->resolution.lat);
-    bstruct_writereal(file,"cellsize_lon",config->resolution.lon);
-    bstruct_writeint(file,"datatype",(sizeof(Real)==sizeof(float)) ? LPJ_FLOAT : LPJ_DOUBLE);
-    bstruct_writebool(file,"landuse",(config->withlanduse!=NO_LANDUSE));
-    bstruct_writeint(file,"sdate_option",config->sdate_option);
-    bstruct_writebool(file,"crop_phu_option",config->crop_phu_option>=PRESCRIBED_CROP_PHU);
-    bstruct_writebool(file,"river_routing",config->river_routing);
-    bstruct_writebool(file,"separate_harvests",config->separate_harvests);
-    /* write array of all PFT names */
-    bstruct_writebeginarray(file,"pfts",npft+ncft);
-    for(p=0;p<npft+ncft;p++)
-      bstruct_writestring(file,NULL,config->pftpar[p].name);
-    bstruct_writeendarray(file);
-    fwriteseed(file,"seed",config->seed);
-    bstruct_writeendstruct(file);
-    /* define array with index vector and get position of first element of index vector */
-    bstruct_writebeginindexarray(file,"grid",&filepos,config->nall);
-  }
+  bstruct_setcompress(file,config->restart_compression);
   index=newvec(long long,config->ngridcell);
   check(index);
-  /* write cell data and get index vector */
-  if(fwritecell(file,index,grid,config->ngridcell,ncft,npft,ischeckpoint,config)!=config->ngridcell)
+  /* write header and cell data and get index vector */
+  if(writecells(file,index,&filepos,&start,grid,npft,ncft,year,ischeckpoint,config))
   {
     fprintf(stderr,"ERROR153: Cannot write data in restart file '%s': %s\n",
             filename,strerror(errno));
     free(index);
     bstruct_finish(file);
-#ifdef USE_MPI
-    iserror=TRUE;
-    if(config->rank<config->ntask-1)
-      MPI_Send(&iserror,1,MPI_INT,config->rank+1,MSGTAG,config->comm);
-#endif
     return TRUE;
   }
-  if(config->rank==config->ntask-1)
-    bstruct_writeendarray(file);
   /* write index vector */
-  bstruct_writearrayindex(file,filepos,index,config->startgrid-config->firstgrid,config->ngridcell);
-  if(config->ntask>1)
-    /* wait until all data are completely written */
-    bstruct_sync(file);
+  bstruct_writearrayindex(file,filepos,index,0,config->ngridcell);
   free(index);
-#ifdef USE_MPI
-  iserror=FALSE;
-  if(config->rank<config->ntask-1)
-  {
-    /* send message to next task to write further data */
-    MPI_Send(&iserror,1,MPI_INT,config->rank+1,MSGTAG,config->comm);
-    /* send file position of index vector */
-    MPI_Send(&filepos,1,MPI_LONG,config->rank+1,MSGTAG,config->comm);
-    /* send contents of hash */
-    sendhash(bstruct_gethash(file),config->rank+1,config->comm);
-    bstruct_freehash(file);
-  }
-#endif
-  bstruct_finish(file);
-#ifdef USE_TIMING
-#ifdef USE_MPI
-  MPI_Barrier(config->comm);
-#endif
-#endif
-  return FALSE;
+  return bstruct_finish(file);
 } /* of 'fwriterestart' */
@@ -0,0 +1,153 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**        g  e  t  b  a  s  i  n  c  o  u  n  t  s  .  c                          \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function distributes grid cells on tasks using the river network.          \n**/
+/**     Each task gets a contiguous range of cells. Task boundaries are put        \n**/
+/**     at the nearest position not crossed by any river connection, so            \n**/
+/**     complete river basins are assigned to one task. Only basins larger         \n**/
+/**     than the mean number of cells per task are split, at the position          \n**/
+/**     crossed by the fewest connections, i.e. at a sub-tree boundary.            \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+static Bool readroutes(int next[],          /**< index of downstream cell or -1 */
+                       const Config *config /**< LPJmL configuration */
+                      )                     /** \return TRUE on error */
+{
+  FILE *file;
+  Header header;
+  String headername;
+  Routing r;
+  Bool swap;
+  int cell,version;
+  size_t offset;
+  file=openinputfile(&header,NULL,NULL,NULL,&swap,&config->drainage_filename,
+                     headername,NULL,LPJ_INT,&version,&offset,FALSE,config);
+  if(file==NULL)
+    return TRUE;
+  if(fseek(file,sizeof(Routing)*(config->firstgrid-header.firstcell)+offset,SEEK_CUR))
+  {
+    fprintf(stderr,"ERROR139: Cannot seek to drainage of cell %d.\n",
+            config->firstgrid);
+    fclose(file);
+    return TRUE;
+  }
+  for(cell=0;cell<config->nall;cell++)
+  {
+    if(getroute(file,&r,swap))
+    {
+      fprintf(stderr,"ERROR144: Cannot read river route for cell %d.\n",
+              cell+config->firstgrid);
+      fclose(file);
+      return TRUE;
+    }
+    /* connections to cells outside the simulated range are ignored */
+    next[cell]=(r.index>=config->firstgrid && r.index<config->firstgrid+config->nall) ? r.index-config->firstgrid : -1;
+  }
+  fclose(file);
+  return FALSE;
+} /* of 'readroutes' */
+
+Bool getbasincounts(int counts[],        /**< number of cells for each task */
+                    const Config *config /**< LPJmL configuration */
+                   )                     /** \return TRUE on error */
+{
+  int *next,*cut;
+  int i,task,first,ideal,b,b_min,b_max,left,right,share,ncut_equal,ncut;
+  Bool rc;
+  rc=FALSE;
+  if(isroot(*config))
+  {
+    next=newvec(int,config->nall);
+    cut=newvec(int,config->nall+1);
+    if(next==NULL || cut==NULL)
+    {
+      printallocerr("cut");
+      rc=TRUE;
+    }
+    else
+    {
+      rc=readroutes(next,config);
+      if(!rc)
+      {
+        /* cut[b] is the number of river connections crossing a task boundary before cell b */
+        for(i=0;i<=config->nall;i++)
+          cut[i]=0;
+        for(i=0;i<config->nall;i++)
+          if(next[i]>=0 && next[i]!=i)
+          {
+            cut[min(i,next[i])+1]++;
+            cut[max(i,next[i])+1]--;
+          }
+        for(i=1;i<=config->nall;i++)
+          cut[i]+=cut[i-1];
+        /* number of connections crossing task boundaries with equal decomposition */
+        ncut_equal=0;
+        first=0;
+        for(task=0;task<config->ntask-1;task++)
+        {
+          first+=config->nall/config->ntask+((task<config->nall % config->ntask) ? 1 : 0);
+          ncut_equal+=cut[first];
+        }
+        share=max(1,config->nall/config->ntask);
+        ncut=0;
+        first=0;
+        for(task=0;task<config->ntask-1;task++)
+        {
+          ideal=first+(config->nall-first)/(config->ntask-task);
+          b_min=first+1;
+          b_max=config->nall-(config->ntask-task-1);
+          /* find range of river basins enclosing the balanced position */
+          for(left=ideal;left>first && cut[left]>0;left--);
+          for(right=ideal;right<config->nall && cut[right]>0;right++);
+          if(right-left<=share && (left>=b_min || right<=b_max))
+          {
+            /* basins are not larger than one task, put boundary at nearest basin boundary */
+            b=(left<b_min || (right<=b_max && right-ideal<ideal-left)) ? right : left;
+          }
+          else
+          {
+            /* split basins larger than one task at position with fewest cut connections */
+            b=ideal;
+            for(i=max(b_min,ideal-share/2);i<=min(b_max,ideal+share/2);i++)
+              if(cut[i]<cut[b] || (cut[i]==cut[b] && abs(i-ideal)<abs(b-ideal)))
+                b=i;
+          }
+          counts[task]=b-first;
+          ncut+=cut[b];
+          first=b;
+        }
+        counts[config->ntask-1]=config->nall-first;
+        if(ncut>ncut_equal)
+        {
+          /* basin boundaries cut more connections, use equal decomposition */
+          for(task=0;task<config->ntask;task++)
+            counts[task]=config->nall/config->ntask+((task<config->nall % config->ntask) ? 1 : 0);
+          ncut=ncut_equal;
+        }
+        if(config->scan_verbose>=VERB)
+          printf("River connections crossing task boundaries: %d with equal decomposition, %d with basin decomposition.\n",
+                 ncut_equal,ncut);
+      }
+    }
+    free(next);
+    free(cut);
+  }
+#ifdef USE_MPI
+  MPI_Bcast(&rc,1,MPI_INT,0,config->comm);
+  if(!rc)
+    MPI_Bcast(counts,config->ntask,MPI_INT,0,config->comm);
+#endif
+  return rc;
+} /* of 'getbasincounts' */
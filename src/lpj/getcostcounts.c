@@ -0,0 +1,139 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**         g  e  t  c  o  s  t  c  o  u  n  t  s  .  c                            \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function distributes grid cells on tasks using the cell costs              \n**/
+/**     read from file. Each task gets a contiguous range of cells with            \n**/
+/**     approximately equal total cost                                             \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#define MINCOST 0.01 /* minimum cost of cell relative to mean cost */
+
+static Bool readcost(float cost[],      /**< cost of each cell */
+                     const char *filename, /**< filename of cost file */
+                     const Config *config  /**< LPJmL configuration */
+                    )                   /** \return TRUE on error */
+{
+  FILE *file;
+  Header header;
+  Bool swap;
+  int version;
+  file=fopen(filename,"rb");
+  if(file==NULL)
+  {
+    printfopenerr(filename);
+    return TRUE;
+  }
+  version=READ_VERSION;
+  if(freadheader(file,&header,&swap,LPJ_COST_HEADER,&version,TRUE))
+  {
+    fprintf(stderr,"ERROR154: Invalid header in '%s'.\n",filename);
+    fclose(file);
+    return TRUE;
+  }
+  if(header.nbands!=1 || (version>2 && header.datatype!=LPJ_FLOAT))
+  {
+    fprintf(stderr,"ERROR271: Invalid number of bands=%d or datatype in '%s', must be 1 and float.\n",
+            header.nbands,filename);
+    fclose(file);
+    return TRUE;
+  }
+  if(config->firstgrid<header.firstcell || config->firstgrid+config->nall>header.firstcell+header.ncell)
+  {
+    fprintf(stderr,"ERROR271: Cells %d-%d not in range %d-%d of '%s'.\n",
+            config->firstgrid,config->firstgrid+config->nall-1,
+            header.firstcell,header.firstcell+header.ncell-1,filename);
+    fclose(file);
+    return TRUE;
+  }
+  if(fseek(file,headersize(LPJ_COST_HEADER,version)+sizeof(float)*(config->firstgrid-header.firstcell),SEEK_SET))
+  {
+    fprintf(stderr,"ERROR271: Cannot seek in '%s'.\n",filename);
+    fclose(file);
+    return TRUE;
+  }
+  if(freadfloat(cost,config->nall,swap,file)!=config->nall)
+  {
+    fprintf(stderr,"ERROR271: Cannot read cost data from '%s'.\n",filename);
+    fclose(file);
+    return TRUE;
+  }
+  fclose(file);
+  return FALSE;
+} /* of 'readcost' */
+
+Bool getcostcounts(int counts[],           /**< number of cells for each task */
+                   const char *filename,   /**< filename of cost file */
+                   const Config *config    /**< LPJmL configuration */
+                  )                        /** \return TRUE on error */
+{
+  float *cost;
+  Real sum,target,partsum;
+  Bool rc;
+  int i,task;
+  rc=FALSE;
+  if(isroot(*config))
+  {
+    cost=newvec(float,config->nall);
+    if(cost==NULL)
+    {
+      printallocerr("cost");
+      rc=TRUE;
+    }
+    else
+    {
+      rc=readcost(cost,filename,config);
+      if(!rc)
+      {
+        sum=0;
+        for(i=0;i<config->nall;i++)
+        {
+          if(cost[i]<0 || isnan(cost[i]))
+            cost[i]=0;
+          sum+=cost[i];
+        }
+        /* cells without cost still need some time for input and output */
+        for(i=0;i<config->nall;i++)
+          cost[i]=(sum>0) ? max(cost[i],MINCOST*sum/config->nall) : 1;
+        sum=0;
+        for(i=0;i<config->nall;i++)
+          sum+=cost[i];
+        /* split cost array into ntask contiguous ranges with approximately equal sum */
+        i=0;
+        for(task=0;task<config->ntask-1;task++)
+        {
+          target=sum/(config->ntask-task);
+          partsum=0;
+          counts[task]=0;
+          /* at least one cell for each task is left */
+          while(config->nall-i>config->ntask-task &&
+                (counts[task]==0 || partsum+0.5*cost[i]<=target))
+          {
+            partsum+=cost[i++];
+            counts[task]++;
+          }
+          sum-=partsum;
+        }
+        counts[config->ntask-1]=config->nall-i;
+      }
+      free(cost);
+    }
+  }
+#ifdef USE_MPI
+  MPI_Bcast(&rc,1,MPI_INT,0,config->comm);
+  if(!rc)
+    MPI_Bcast(counts,config->ntask,MPI_INT,0,config->comm);
+#endif
+  return rc;
+} /* of 'getcostcounts' */
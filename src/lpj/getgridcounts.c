@@ -0,0 +1,32 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**         g  e  t  g  r  i  d  c  o  u  n  t  s  .  c                            \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function gets number of items and offsets for each task for                \n**/
+/**     MPI collective operations using the domain decomposition                   \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+void getgridcounts(int counts[],         /**< number of items for each task */
+                   int offsets[],        /**< item offsets for each task */
+                   int n,                /**< number of items per cell */
+                   const Config *config  /**< LPJmL configuration */
+                  )
+{
+  int i;
+  for(i=0;i<config->ntask;i++)
+    counts[i]=config->cellcounts[i]*n;
+  offsets[0]=0;
+  for(i=1;i<config->ntask;i++)
+    offsets[i]=offsets[i-1]+counts[i-1];
+} /* of 'getgridcounts' */
@@ -28,6 +28,7 @@ Real gp_sum(const Pftlist *pftlist, /**< [in] Pft list */
   int p;
   Pft *pft;
   Real agd,adtmm,gp,gp_stand,rd;
+  Photocoeff coeff;
   *gp_stand_leafon=gp=*fpc_total=gp_stand=0;
   if(daylength<1e-20)
   {
@@ -35,13 +36,14 @@ Real gp_sum(const Pftlist *pftlist, /**< [in] Pft list */
       gp_pft[getpftpar(pft,id)]=0;
     return 0;
   }
+  photocoeff(&coeff,temp);
   foreachpft(pft,p,pftlist)
   {
     if(pft->par->type==CROP)
     {
       adtmm=photosynthesis(&agd,&rd,&pft->vmax,pft->par->path,LAMBDA_OPT,
                            temp_stress(pft->par,temp,daylength),pft->b,ppm2Pa(co2),
-                           temp,
+                           &coeff,
                            par*(1-getpftpar(pft,albedo_leaf))*fpar_crop(pft)*alphaa(pft,config->laimax_manage),
                            daylength,TRUE);
       gp=(1.6*adtmm/(ppm2bar(co2)*(1.0-LAMBDA_OPT)*hour2sec(daylength)))+
@@ -53,7 +55,7 @@ Real gp_sum(const Pftlist *pftlist, /**< [in] Pft list */
     {
       adtmm=photosynthesis(&agd,&rd,&pft->vmax,pft->par->path,LAMBDA_OPT,
                            temp_stress(pft->par,temp,daylength),pft->b,ppm2Pa(co2),
-                           temp,
+                           &coeff,
                            par*pft->fpc*alphaa(pft,config->laimax_manage)*(1-getpftpar(pft,albedo_leaf))*(1-pft->snowcover),
                            daylength,TRUE);
       gp=(1.6*adtmm/(ppm2bar(co2)*(1.0-LAMBDA_OPT)*hour2sec(daylength)))+
@@ -68,7 +68,7 @@ static int *getindex(const Input_netcdf input,const Cell grid[],
     free(offsets);
     return NULL;
   }
-  getcounts(counts,offsets,config->nall,1,config->ntask);
+  getgridcounts(counts,offsets,1,config);
   for(cell=0;cell<config->ngridcell;cell++)
     vec[cell]=(int)getindexinput_netcdf(input,&grid[cell].coord);
   MPI_Gatherv(vec,config->ngridcell,MPI_INT,
@@ -144,7 +144,7 @@ static Bool initirrig(Cell grid[],    /**< Cell grid             */
 #ifdef USE_MPI
   config->irrig_neighbour=pnet_init(config->comm,
                                     (sizeof(Real)==sizeof(double)) ? MPI_DOUBLE : MPI_FLOAT,
-                                    config->nall);
+                                    config->nall,config->cellcounts);
 #else
   config->irrig_neighbour=pnet_init(sizeof(Real),config->nall);
 #endif
@@ -275,7 +275,7 @@ static Bool initriver(Cell grid[],Config *config)
 #ifdef USE_MPI
   config->route=pnet_init(config->comm,
                           (sizeof(Real)==sizeof(double)) ? MPI_DOUBLE : MPI_FLOAT,
-                          config->nall);
+                          config->nall,config->cellcounts);
 #else
   config->route=pnet_init(sizeof(Real),config->nall);
 #endif
@@ -383,7 +383,8 @@ static Bool initriver(Cell grid[],Config *config)
       }
     }
 
-    if(r.index>=0)
+    /* connections within the cells of this task are handled in drain() without pnet */
+    if(r.index>=0 && (r.index<config->startgrid || r.index>=config->startgrid+config->ngridcell))
     {
       /* add connection */
       rc=pnet_addconnect(config->route,
@@ -439,6 +440,12 @@ Bool initdrain(Cell grid[],    /**< Cell grid             */
     return TRUE;
   pnet_reverse(config->route);
   pnet_setup(config->route);
+  /* inflow from cells of the same task, pnet only holds connections to other tasks */
+  config->fin_local=newvec(Real,config->ngridcell);
+  if(config->fin_local==NULL)
+    printallocerr("fin_local");
+  if(iserror(config->fin_local==NULL,config))
+    return TRUE;
   return FALSE;
 } /* of 'initdrain' */
 
@@ -52,7 +52,8 @@ int iterate(Outputfile *output, /**< Output file data */
   double t;
 #endif
   Bool rc;
-  Climatedata store,data_save;
+  Climatestore store;
+  Climatedata data_save;
   if (config->isanomaly)
     data_index = (config->delta_year>1) ? 3 : 1;
   else
@@ -74,7 +75,7 @@ int iterate(Outputfile *output, /**< Output file data */
     /* climate for the first nspinyear years is stored in memory
        to avoid reading repeatedly from disk */
 #ifdef USE_TIMING
-    timing_start(t);
+    timing_start(STORECLIMATE_FCN,t);
 #endif
     rc=storeclimate(&store,input.climate, grid,firstspinupyear,config->nspinyear,config);
 #ifdef USE_TIMING
@@ -102,6 +103,9 @@ int iterate(Outputfile *output, /**< Output file data */
     printf("Starting from checkpoint file '%s'.\n",config->checkpoint_restart_filename);
   for(year=startyear;year<=config->lastyear;year++)
   {
+    /* NetCDF library is not thread-safe, NetCDF output of writer thread has to be finished before input is read */
+    if(output->queue!=NULL)
+      syncnetcdfqueue(output->queue);
 #if defined IMAGE && defined COUPLED
     if(year>=config->start_coupling)
     {
@@ -149,7 +153,7 @@ int iterate(Outputfile *output, /**< Output file data */
       else
       {
 #ifdef USE_TIMING
-        timing_start(t);
+        timing_start(GETCLIMATE_FCN,t);
 #endif
         getclimate(input.climate,grid,data_index,firstspinupyear+spinup_year,config);
 #ifdef USE_TIMING
@@ -159,7 +163,7 @@ int iterate(Outputfile *output, /**< Output file data */
       if (config->isanomaly)
       {
 #ifdef USE_TIMING
-        timing_start(t);
+        timing_start(GETCLIMATE_FCN,t);
 #endif
         getclimate(input.climate,grid,0,config->firstyear,config);
 #ifdef USE_TIMING
@@ -176,7 +180,7 @@ int iterate(Outputfile *output, /**< Output file data */
       {
         /* restore climate data pointers to initial data */
         input.climate->data[0]=data_save;
-        freeclimatedata(&store); /* free data not used anymore */
+        freeclimatestore(&store); /* free data not used anymore */
       }
       /* read climate from files */
 #if defined IMAGE && defined COUPLED
@@ -203,7 +207,7 @@ int iterate(Outputfile *output, /**< Output file data */
           if (year==config->firstyear || (config->ischeckpoint && year==startyear))
           {
 #ifdef USE_TIMING
-            timing_start(t);
+            timing_start(GETCLIMATE_FCN,t);
 #endif
             if (getclimate(input.climate,grid,1,year,config))
             {
@@ -240,7 +244,7 @@ int iterate(Outputfile *output, /**< Output file data */
           else if (year != config->lastyear && (year - config->firstyear) % config->delta_year == 0)
           {
 #ifdef USE_TIMING
-            timing_start(t);
+            timing_start(GETCLIMATE_FCN,t);
 #endif
             if (getclimate(input.climate, grid, index + 1, year, config))
             {
@@ -269,7 +273,7 @@ int iterate(Outputfile *output, /**< Output file data */
         else
         {
 #ifdef USE_TIMING
-          timing_start(t);
+          timing_start(GETCLIMATE_FCN,t);
 #endif
           if(getclimate(input.climate,grid,0,year,config))
           {
@@ -310,7 +314,7 @@ int iterate(Outputfile *output, /**< Output file data */
         else
           climate_year=year;
 #ifdef USE_TIMING
-        timing_start(t);
+        timing_start(GETCLIMATE_FCN,t);
 #endif
         rc=getclimate(input.climate,grid,0,climate_year,config);
 #ifdef USE_TIMING
@@ -325,6 +329,14 @@ int iterate(Outputfile *output, /**< Output file data */
           }
           break; /* leave time loop */
         }
+        if(config->readahead_climate && year<config->lastyear)
+        {
+          /* read and convert climate of next year while current year is simulated */
+          if(!config->fix_climate || year+1<=config->fix_climate_year)
+            readaheadclimate(input.climate,year+1,config);
+          else if(!config->fix_climate_shuffle)
+            readaheadclimate(input.climate,config->fix_climate_interval[0]+(year+1-config->fix_climate_year) % (config->fix_climate_interval[1]-config->fix_climate_interval[0]+1),config);
+        }
       }
     }
     if(config->fix_deposition)
@@ -359,9 +371,22 @@ int iterate(Outputfile *output, /**< Output file data */
       }
       break; /* leave time loop */
     }
+    if(config->spinup_convergence && (year==config->firstyear-1 || (iswriterestart(config) && year==config->restartyear)))
+      unfreezecells(grid,config); /* converged cells have to be simulated before restart file is written */
     rc=iterateyear(output,grid,&input,co2,&ch4,&pch4,npft,ncft,year,config);
     if(rc)
       break;
+    if(config->spinup_convergence && year<config->firstyear-1 && checkspinup(grid,year,config))
+    {
+      /* stocks of all cells have converged, terminate spinup */
+      unfreezecells(grid,config);
+      if(isroot(*config))
+        printf("Spinup converged in year %d, remaining %d spinup years skipped.\n",
+               year,config->firstyear-1-year);
+      if(iswriterestart(config) && config->restartyear>year && config->restartyear<config->firstyear)
+        fwriterestart(grid,npft,ncft,config->restartyear,config->write_restart_filename,FALSE,config);
+      year=config->firstyear-1;
+    }
 #if defined IMAGE && defined COUPLED
     if(year>=config->start_coupling)
     {
@@ -388,6 +413,8 @@ int iterate(Outputfile *output, /**< Output file data */
       {
         if(isroot(*config))
           printf("SIGTERM catched, checkpoint file '%s' written.\n",config->checkpoint_restart_filename);
+        if(config->spinup_convergence)
+          unfreezecells(grid,config);
         fwriterestart(grid,npft,ncft,year,config->checkpoint_restart_filename,TRUE,config); /* write checkpoint file */
         fcloseoutput(output,config);
 #ifdef USE_MPI
@@ -401,7 +428,7 @@ int iterate(Outputfile *output, /**< Output file data */
   {
     /* restore climate data pointers to initial data */
     input.climate->data[data_index]=data_save;
-    freeclimatedata(&store); /* free data not used anymore */
+    freeclimatestore(&store); /* free data not used anymore */
   }
   if(year>config->lastyear && config->ischeckpoint)
     unlink(config->checkpoint_restart_filename); /* delete checkpoint file */
@@ -30,10 +30,13 @@ Bool iterateyear(Outputfile *output,  /**< Output file data */
                 )                     /** \return TRUE on error */
 {
   Dailyclimate daily;
-  Bool intercrop;
+  Bool intercrop,isdailytemp;
   int month,dayofmonth,day;
   int cell;
+  double tcost;
   intercrop=getintercrop(input->landuse);
+  /* same setting as in dailyclimate(), independent of cells simulated */
+  isdailytemp=input->climate->file_temp.fmt==FMS || isdaily(input->climate->file_temp);
   if(setupannual_grid(output,grid,input,year,npft,ncft,intercrop,config))
     return TRUE;
   day=1;
@@ -42,16 +45,24 @@ Bool iterateyear(Outputfile *output,  /**< Output file data */
     initmonthly_grid(grid,month,year,input->climate,config);
     foreachdayofmonth(dayofmonth,month)
     {
+      /* cells are independent of each other, daily climate is private to each thread */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(config->nthreads) private(daily,tcost) schedule(guided)
+#endif
       for(cell=0;cell<config->ngridcell;cell++)
       {
+        /* measure computing time of cell for cost based domain decomposition */
+        tcost=(config->write_cost_filename!=NULL) ? mrun() : 0;
         update_daily_cell(grid+cell,cell,&daily,co2,*pch4,input,day,dayofmonth,month,year,
                           npft,ncft,intercrop,config);
+        if(config->write_cost_filename!=NULL)
+          grid[cell].cost+=mrun()-tcost;
       }
       updatedaily_grid(output,grid,input->extflow,day,month,year,npft,ncft,config);
       day++;
     } /* of 'foreachdayofmonth */
     update_monthly_grid(output,grid,input->climate,month,year,npft,ncft,config);
   } /* of 'foreachmonth */
-  updateannual_grid(output,grid,input->landcover,co2,ch4,pch4,year,npft,ncft,intercrop,daily.isdailytemp,config);
+  updateannual_grid(output,grid,input->landcover,co2,ch4,pch4,year,npft,ncft,intercrop,isdailytemp,config);
   return FALSE;
 } /* of 'iterateyear' */
@@ -188,7 +188,7 @@ static Cell *newgrid2(Config *config,          /* Pointer to LPJ configuration *
   }
   else
   {
-    file_restart=openrestart((config->ischeckpoint) ? config->checkpoint_restart_filename : config->restart_filename,config,npft,ncft);
+    file_restart=openrestart((config->ischeckpoint) ? config->checkpoint_restart_filename : config->restart_filename,config,npft,ncft,config->fast_restart);
     if(file_restart==NULL)
     {
       if(isroot(*config))
@@ -291,6 +291,10 @@ static Cell *newgrid2(Config *config,          /* Pointer to LPJ configuration *
     grid[i].balance.daily_surface_prev=grid[i].balance.daily_soil_prev=0.0;
 #endif
     grid[i].balance.ricefrac=0.0;
+    grid[i].cost=0;
+    grid[i].spinup_sum.carbon=grid[i].spinup_sum.nitrogen=0;
+    grid[i].spinup_mean.carbon=grid[i].spinup_mean.nitrogen=0;
+    grid[i].isconverged=FALSE;
     grid[i].discharge.waterdeficit=0.0;
 #ifdef IMAGE
     grid[i].discharge.wateruse_wd=newvec(Real,NMONTH);
@@ -50,5 +50,6 @@ void newpft(Pft *pft,            /**< PFT variables */
 #endif
   pft->establish.carbon=pft->establish.nitrogen=0;
   pft->b=pft->par->b;
+  pft->lambda=LAMBDA_OPT;
   pft->par->newpft(pft,year,day,config); /* type-specific allocation of memory */
 } /* of 'newpft' */
@@ -20,7 +20,7 @@ void newpftlist(Pftlist *pftlist /**< PFT list */
                )
 {
   /* Initialize PFT list to empty list */
-  pftlist->n=0;
+  pftlist->n=pftlist->size=0;
   pftlist->pft=NULL;
 } /* of 'newpftlist' */
  
@@ -36,16 +36,8 @@ int delpft(Pftlist *pftlist, /**< PFT list */
 #endif
   freepft(pftlist->pft+index);
   pftlist->n--;
-  if(pftlist->n)
-  {
-    pftlist->pft[index]=pftlist->pft[pftlist->n];
-    pftlist->pft=(Pft *)realloc(pftlist->pft,sizeof(Pft)*pftlist->n);
-  }
-  else
-  {
-    free(pftlist->pft);
-    pftlist->pft=NULL;
-  }
+  /* array is not shrunk, allocated memory is reused by addpft() */
+  pftlist->pft[index]=pftlist->pft[pftlist->n];
   return pftlist->n;
 } /* of 'delpft ' */
 
@@ -87,6 +79,7 @@ Bool freadpftlist(Bstruct file,          /**< pointer to restart file */
   /* read number of established PFTs */
   if(bstruct_readbeginarray(file,name,&pftlist->n))
     return TRUE;
+  pftlist->size=pftlist->n;
   if(pftlist->n)
   {
     /* allocate memory for PFT array */
@@ -94,7 +87,7 @@ Bool freadpftlist(Bstruct file,          /**< pointer to restart file */
     if(pftlist->pft==NULL)
     {
       printallocerr("pftlist");
-      pftlist->n=0;
+      pftlist->n=pftlist->size=0;
       return TRUE;
     }
     for(p=0;p<pftlist->n;p++)
@@ -114,14 +107,11 @@ void freepftlist(Pftlist *pftlist /**< PFT list */
                 )
 {
   int p;
-  if(pftlist->n)
-  {
-    for(p=0;p<pftlist->n;p++)
-      freepft(pftlist->pft+p);
-    free(pftlist->pft);
-    pftlist->n=0;
-    pftlist->pft=NULL;
-  }
+  for(p=0;p<pftlist->n;p++)
+    freepft(pftlist->pft+p);
+  free(pftlist->pft);
+  pftlist->n=pftlist->size=0;
+  pftlist->pft=NULL;
 } /* of 'freepftlist' */
 
 Pft *addpft(Stand *stand,         /**< Stand pointer */
@@ -131,10 +121,14 @@ Pft *addpft(Stand *stand,         /**< Stand pointer */
             const Config *config  /**< LPJmL configuration */
            )                      /** \return pointer to added PFT */
 {
-  /* resize PFT array */
-  stand->pftlist.pft=(Pft *)realloc(stand->pftlist.pft,
-                                    sizeof(Pft)*(stand->pftlist.n+1));
-  check(stand->pftlist.pft);
+  if(stand->pftlist.n==stand->pftlist.size)
+  {
+    /* double size of PFT array to avoid reallocation for each PFT added */
+    stand->pftlist.size=(stand->pftlist.size==0) ? 1 : 2*stand->pftlist.size;
+    stand->pftlist.pft=(Pft *)realloc(stand->pftlist.pft,
+                                      sizeof(Pft)*stand->pftlist.size);
+    check(stand->pftlist.pft);
+  }
   newpft(stand->pftlist.pft+stand->pftlist.n,stand,pftpar,year,day,config);
   return stand->pftlist.pft+stand->pftlist.n++;
 } /* of 'addpft' */
@@ -0,0 +1,36 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              p  h  o  t  o  c  o  e  f  f  .  c                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Computes temperature-dependent coefficients of photosynthesis              \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#define po2 20.9e3    /* O2 partial pressure in Pa */
+#define q10ko 1.2     /* q10 for temperature-sensitive parameter ko */
+#define q10kc 2.1     /* q10 for temperature-sensitive parameter kc */
+#define q10tau 0.57   /* q10 for temperature-sensitive parameter tau */
+#define tau25 2600.0  /* value of tau at 25 deg C */
+
+void photocoeff(Photocoeff *coeff, /**< [out] temperature-dependent coefficients */
+                Real temp          /**< [in] temperature (deg C) */
+               )                   /** \return void */
+{
+  Real ko,kc,tau;
+  coeff->temp=temp;
+  ko=param.ko25*pow(q10ko,(temp-25)*0.1);
+  kc=param.kc25*pow(q10kc,(temp-25)*0.1);
+  coeff->fac=kc*(1+po2/ko);
+  tau=tau25*pow(q10tau,(temp-25)*0.1); /*reflects the abiltiy of Rubisco to discriminate between CO2 and O2*/
+  coeff->gammastar=po2/(2*tau);
+} /* of 'photocoeff' */
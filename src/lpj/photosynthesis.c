@@ -19,12 +19,7 @@
 
 #include "lpj.h"
 
-#define po2 20.9e3    /* O2 partial pressure in Pa */
 #define p 1.0e5       /* atmospheric pressure in Pa */
-#define q10ko 1.2     /* q10 for temperature-sensitive parameter ko */
-#define q10kc 2.1     /* q10 for temperature-sensitive parameter kc */
-#define q10tau 0.57   /* q10 for temperature-sensitive parameter tau */
-#define tau25 2600.0  /* value of tau at 25 deg C */
 #define cq 4.6e-6     /* conversion factor for solar radiation at 550 nm */
                       /* from J/m2 to E/m2 (E mol quanta) */
 #define lambdamc4 0.4 /* optimal ratio of intercellular to ambient CO2 */
@@ -40,15 +35,14 @@ Real photosynthesis(Real *agd,      /**< [out] gross photosynthesis rate (gC/m2/
                     Real tstress,   /**< [in] temperature-related stress factor */
                     Real b,         /**< [in] leaf respiration as fraction of vmax (0..1) */
                     Real co2,       /**< [in] atmospheric CO2 partial pressure (Pa) */
-                    Real temp,      /**< [in] temperature (deg C) */
+                    const Photocoeff *coeff, /**< [in] temperature-dependent coefficients */
                     Real apar,      /**< [in] absorbed photosynthetic active radiation (J/m2/day) */
                     Real daylength, /**< [in] daylength (h) */
                     Bool comp_vm    /**< [in] vmax value is computed internally and returned (TRUE/FALSE) */
                    )                /** \return CO2 gas flux (mm/m2/day) */
 {
-  Real ko,kc,tau,pi,c1,c2;
+  Real pi,c1,c2;
   Real je,jc,phipi,adt,s,sigma;
-  Real fac,gammastar;
   if(tstress<1e-2)
   {
     *agd=0;
@@ -61,31 +55,28 @@ Real photosynthesis(Real *agd,      /**< [out] gross photosynthesis rate (gC/m2/
   {
     if(path==C3)
     {
-      ko=param.ko25*pow(q10ko,(temp-25)*0.1);
-      kc=param.kc25*pow(q10kc,(temp-25)*0.1);
-      fac=kc*(1+po2/ko);
-      tau=tau25*pow(q10tau,(temp-25)*0.1); /*reflects the abiltiy of Rubisco to discriminate between CO2 and O2*/
-      gammastar=po2/(2*tau);
-      pi=lambdamc3*co2;
-      c1=tstress*param.alphac3*((pi-gammastar)/(pi+2.0*gammastar));
-
-      /* Calculation of C2C3, Eqn 6, Haxeltine & Prentice 1996 */
-
-      c2=(pi-gammastar)/(pi+fac);
-
-      s=(24/daylength)*b;
-      sigma=1-(c2-s)/(c2-param.theta*s);
-      sigma= (sigma<=0) ? 0 : sqrt(sigma);
-      /* Choose C3 value of b for Eqn 10, Haxeltine & Prentice 1996 */
-      /*
-       *       Intercellular CO2 partial pressure in Pa
-       *       Eqn 7, Haxeltine & Prentice 1996
-       */
-
-      /* Calculation of V_max (Rubisco activity) in gC/d/m2*/
-
+      /* temperature-dependent terms are taken from coeff, only terms
+         depending on lambda are computed here */
       if(comp_vm)
       {
+        pi=lambdamc3*co2;
+        c1=tstress*param.alphac3*((pi-coeff->gammastar)/(pi+2.0*coeff->gammastar));
+
+        /* Calculation of C2C3, Eqn 6, Haxeltine & Prentice 1996 */
+
+        c2=(pi-coeff->gammastar)/(pi+coeff->fac);
+
+        s=(24/daylength)*b;
+        sigma=1-(c2-s)/(c2-param.theta*s);
+        sigma= (sigma<=0) ? 0 : sqrt(sigma);
+        /* Choose C3 value of b for Eqn 10, Haxeltine & Prentice 1996 */
+        /*
+         *       Intercellular CO2 partial pressure in Pa
+         *       Eqn 7, Haxeltine & Prentice 1996
+         */
+
+        /* Calculation of V_max (Rubisco activity) in gC/d/m2*/
+
         *vm=(1.0/b)*(c1/c2)*((2.0*param.theta-1.0)*s-(2.0*param.theta*s-c2)*sigma)*apar*WC*cq;
         if(*vm<0)
           *vm=0;
@@ -95,19 +86,19 @@ Real photosynthesis(Real *agd,      /**< [out] gross photosynthesis rate (gC/m2/
 
       /* Recalculation of C1C3, C2C3 with actual pi */
 
-      c1=tstress*param.alphac3*((pi-gammastar)/(pi+2.0*gammastar));
+      c1=tstress*param.alphac3*((pi-coeff->gammastar)/(pi+2.0*coeff->gammastar));
 
-      c2=(pi-gammastar)/(pi+fac);
+      c2=(pi-coeff->gammastar)/(pi+coeff->fac);
     }
     else /* C4 photosynthesis */
     {
       c1=tstress*param.alphac4;
       c2=1.0;
-      s=(24/daylength)*b;
-      sigma=1-(c2-s)/(c2-param.theta*s);
-      sigma= (sigma<=0) ? 0 : sqrt(sigma);
       if(comp_vm)
       {
+        s=(24/daylength)*b;
+        sigma=1-(c2-s)/(c2-param.theta*s);
+        sigma= (sigma<=0) ? 0 : sqrt(sigma);
         *vm=(1.0/b)*c1/c2*((2.0*param.theta-1.0)*s-(2.0*param.theta*s-c2)*sigma)*apar*WC*cq;
         if(*vm<0)
           *vm=0;
@@ -162,6 +153,6 @@ Real photosynthesis(Real *agd,      /**< [out] gross photosynthesis rate (gC/m2/
     /*    Convert adt from gC/m2/day to mm/m2/day using
      *    ideal gas equation
      */
-    return (adt<=0) ? 0 : adt/WC*8.314*degCtoK(temp)/p*1000.0;
+    return (adt<=0) ? 0 : adt/WC*8.314*degCtoK(coeff->temp)/p*1000.0;
   }
 } /* of 'photosynthesis' */
@@ -35,6 +35,7 @@ Bool readconfig(Config *config,        /**< LPJ configuration */
   config->arglist=catstrvec(*argv,*argc); /* store command line in arglist */
   config->coupled_model=NULL;
   config->route=NULL;
+  config->fin_local=NULL;
   config->irrig_neighbour=NULL;
   config->irrig_back=NULL;
   config->irrig_res=NULL;
@@ -34,7 +34,7 @@ Bool setupannual_grid(Outputfile *output,  /**< Output file data */
 #endif
 #ifdef USE_TIMING
   double t;
-  timing_start(t);
+  timing_start(SETUPANNUAL_GRID_FCN,t);
 #endif
   if(input->landuse!=NULL)
   {
@@ -16,6 +16,8 @@
 
 #include "lpj.h"
 
+Mempool standpool={sizeof(Stand),STANDPOOL_CHUNK,0,NULL}; /* pool for stand objects */
+
 Bool fwritestandlist(Bstruct file,              /**< pointer to restart file */
                      const char *key,           /**< name of object */
                      const Standlist standlist, /**< stand list */
@@ -91,7 +93,7 @@ int addstand(const Standtype *type, /**< stand type */
 {
    /* Function adds stand to list */
    Stand *stand;
-   stand=new(Stand);
+   stand=allocstand();
    check(stand);
    addlistitem(cell->standlist,stand);
    stand->cell=cell;
@@ -121,7 +123,7 @@ void freestand(Stand *stand /**< Pointer to stand */
   freesoil(&stand->soil);
   /* call stand-specific free function */
   stand->type->freestand(stand);
-  free(stand);
+  releasestand(stand);
 } /* of 'freestand'  */
  
 int delstand(Standlist list, /**< stand list */
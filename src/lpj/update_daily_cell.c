@@ -74,7 +74,7 @@ void update_daily_cell(Cell *cell,            /**< cell pointer */
   Real rice_emiss=0;
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(UPDATE_DAILY_CELL_FCN,tstart);
 #endif
   if(!cell->skip)
   {
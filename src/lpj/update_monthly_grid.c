@@ -32,15 +32,21 @@ void update_monthly_grid(Outputfile *output,  /**< Output file data */
   Real mtemp,mprec;
   int p,s,cell;
 #ifdef CHECK_BALANCE
-  Stocks start = {0,0};
-  Stocks end = {0,0};
-  Stocks st;
+  Stocks start,end,st;
+#endif
+#ifdef USE_OPENMP
+#ifdef CHECK_BALANCE
+#pragma omp parallel for num_threads(config->nthreads) private(pft,stand,mtemp,mprec,p,s,start,end,st) schedule(guided)
+#else
+#pragma omp parallel for num_threads(config->nthreads) private(pft,stand,mtemp,mprec,p,s) schedule(guided)
+#endif
 #endif
   for(cell=0;cell<config->ngridcell;cell++)
   {
     if(!grid[cell].skip)
     {
 #ifdef CHECK_BALANCE
+      start.carbon=start.nitrogen=end.carbon=end.nitrogen=0;
       foreachstand(stand, s, grid[cell].standlist)
       {
         st= standstocks(stand);
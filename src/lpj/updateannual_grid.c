@@ -47,12 +47,19 @@ void updateannual_grid(Outputfile *output,  /**< Output file data */
   Real cflux_total;
   Flux flux;
   int s,cell;
+  double tcost;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(config->nthreads) private(stand,s,norg_soil_agr,nmin_soil_agr,nveg_soil_agr,tcost) schedule(guided)
+#endif
   for(cell=0;cell<config->ngridcell;cell++)
   {
     if(!grid[cell].skip)
     {
       grid[cell].landcover=(config->prescribe_landcover!=NO_LANDCOVER) ? getlandcover(landcover,cell) : NULL;
+      tcost=(config->write_cost_filename!=NULL) ? mrun() : 0;
       update_annual_cell(grid+cell,npft,ncft,year,isdailytemp,intercrop,config);
+      if(config->write_cost_filename!=NULL)
+        grid[cell].cost+=mrun()-tcost;
 #ifdef SAFE
       if(config->withlanduse)
         check_fluxes(grid+cell,year,cell,config);
@@ -190,12 +197,12 @@ void updateannual_grid(Outputfile *output,  /**< Output file data */
   if(iswriterestart(config) && year==config->restartyear)
   {
 #ifdef USE_TIMING
-    timing_start(t);
+    timing_start(FWRITERESTART_FCN,t);
 #endif
     fwriterestart(grid,npft,ncft,year,config->write_restart_filename,FALSE,config); /* write restart file */
 #ifdef USE_TIMING
 #ifdef USE_MPI
-    timing_start(t2);
+    timing_start(MPI_BARRIER_FCN,t2);
     MPI_Barrier(config->comm);
     timing_stop(MPI_BARRIER_FCN,t2);
 #endif
@@ -28,7 +28,7 @@ void updatedaily_grid(Outputfile *output,  /**< Output file data */
 {
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(UPDATEDAILY_GRID_FCN,tstart);
 #endif
   if(config->river_routing)
   {
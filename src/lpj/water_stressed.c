@@ -15,11 +15,13 @@
 #include "lpj.h"
 
 #define EPSILON 0.001  /* min precision of solution in bisection method */
+#define LAMBDA_DX 0.05 /* half width of initial bracket around lambda of previous day */
 #define k 0.1          /* steepness parameter for inundation stress */
 
 typedef struct
 {
-  Real fac,co2,temp,apar,daylength,tstress,b,vmax;
+  Real fac,co2,apar,daylength,tstress,b,vmax;
+  Photocoeff coeff;
   int path;
   Bool compvm;
 } Data;
@@ -37,7 +39,7 @@ static Real fcn(Real lambda,void *ptr)
  */
   return data->fac*(1-lambda)-photosynthesis(&agd,&rd,&data->vmax,data->path,lambda,
                                              data->tstress,data->b,data->co2,
-                                             data->temp,data->apar,
+                                             &data->coeff,data->apar,
                                              data->daylength,data->compvm);
 /*
  *              Calculate total daytime photosynthesis implied by
@@ -83,7 +85,7 @@ Real water_stressed(Pft *pft,                  /**< [inout] pointer to PFT varia
   Real istress=0;
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(WATER_STRESSED_FCN,tstart);
 #endif
   aet_frac = 1;
   aet=0;
@@ -222,23 +224,26 @@ Real water_stressed(Pft *pft,                  /**< [inout] pointer to PFT varia
   {
     data.fac=gpd/1.6*ppm2bar(co2);
     data.path=pft->par->path;
-    data.temp=temp;
+    photocoeff(&data.coeff,temp);
     data.b=pft->b;
     data.co2=ppm2Pa(co2);
     data.compvm=FALSE;
     data.apar=par*(1-getpftpar(pft, albedo_leaf))*alphaa(pft,config->laimax_manage)*fpar(pft); /** par calculation do not include albedo*/
     data.daylength=daylength;
     data.vmax=pft->vmax;
-    lambda=bisect(fcn,0.02,LAMBDA_OPT+0.05,&data,0,EPSILON,30,&iter);
+    if(config->lambda_solver==ILLINOIS_SOLVER)
+      lambda=illinois(fcn,0.02,LAMBDA_OPT+0.05,pft->lambda,LAMBDA_DX,&data,0,EPSILON,30,&iter);
+    else
+      lambda=bisect(fcn,0.02,LAMBDA_OPT+0.05,&data,0,EPSILON,30,&iter);
     adtmm=photosynthesis(&agd,rd,&pft->vmax,data.path,lambda,data.tstress,data.b,data.co2,
-                         temp,data.apar,daylength,TRUE);
+                         &data.coeff,data.apar,daylength,TRUE);
     vmax=pft->vmax;
     gc_new=(1.6*adtmm/(ppm2bar(co2)*(1.0-lambda)*hour2sec(daylength)))+
                     pft->par->gmin*fpar(pft);
     nitrogen_stress(pft,temp,agd-*rd,npft,ncft,config);
 
     adtmm=photosynthesis(&agd,rd,&pft->vmax,data.path,lambda,data.tstress,data.b,data.co2,
-                         temp,data.apar,daylength,FALSE);
+                         &data.coeff,data.apar,daylength,FALSE);
 #ifdef COUPLING_WITH_FMS
     if(config->nitrogen_coupled)
 #endif
@@ -255,15 +260,19 @@ Real water_stressed(Pft *pft,                  /**< [inout] pointer to PFT varia
         gpd=hour2sec(daylength)*(gc-pft->par->gmin*fpar(pft));
         data.fac=gpd/1.6*ppm2bar(co2);
         data.vmax=pft->vmax;
-        lambda=bisect(fcn,0.02,lambda,&data,0,EPSILON,20,&iter);
+        if(config->lambda_solver==ILLINOIS_SOLVER)
+          lambda=illinois(fcn,0.02,lambda,pft->lambda,LAMBDA_DX,&data,0,EPSILON,20,&iter);
+        else
+          lambda=bisect(fcn,0.02,lambda,&data,0,EPSILON,20,&iter);
         adtmm=photosynthesis(&agd,rd,&pft->vmax,data.path,lambda,data.tstress,data.b,data.co2,
-                             temp,data.apar,daylength,FALSE);
+                             &data.coeff,data.apar,daylength,FALSE);
         gc=(1.6*adtmm/(ppm2bar(co2)*(1.0-lambda)*hour2sec(daylength)))+
                     pft->par->gmin*fpar(pft);
         demand=(gc>0) ? (1-*wet)*eeq*param.ALPHAM/(1+(param.GM*param.ALPHAM)/gc) :0;
       }
       aet=(wr>0) ? demand*fpar(pft)/wr :0 ;
     }
+    pft->lambda=lambda; /* start value for next day */
 
     if(vmax>epsilon)
     {
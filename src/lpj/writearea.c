@@ -62,9 +62,9 @@ int writearea(Outputfile *output,  /**< output file array */
     switch(output->files[index].fmt)
     {
       case RAW: case CLM:
-        mpi_write(output->files[index].fp.file,vec,MPI_FLOAT,config->total,
-                  output->counts,output->offsets,config->rank,config->comm);
-        if(isroot(*config) && config->flush_output)
+        mpi_write_file(output->files+index,vec,MPI_FLOAT,config->total,
+                       output->counts,output->offsets,config->rank,config->comm);
+        if(isroot(*config) && config->flush_output && !output->files[index].isparallel)
           fflush(output->files[index].fp.file);
         break;
       case TXT:
@@ -99,6 +99,9 @@ int main(int argc,char **argv)
   double tbegin,tfinal;
 #ifdef USE_TIMING
   double t;
+#endif
+#if defined USE_MPI && (defined USE_OPENMP || defined USE_PTHREAD)
+  int provided;
 #endif
   Standtype standtype[NSTANDTYPES];
   String s;
@@ -114,7 +117,12 @@ int main(int argc,char **argv)
   time(&tinvoke);
   tbegin=mrun();         /* Start timing for total wall clock time */
 #ifdef USE_MPI
+#if defined USE_OPENMP || defined USE_PTHREAD
+  /* only the master thread performs MPI calls, writer thread only writes with stdio */
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_FUNNELED,&provided); /* Initialize MPI */
+#else
   MPI_Init(&argc,&argv); /* Initialize MPI */
+#endif
 #ifdef USE_TIMING
   timing_stop(MPI_INIT_FCN,tbegin);
 #endif
@@ -191,13 +199,29 @@ int main(int argc,char **argv)
    * crops must have last id-number */
   /* Read configuration file */
 #ifdef USE_TIMING
-  timing_start(t);
+  timing_start(READCONFIG_FCN,t);
 #endif
   rc=readconfig(&config,scanfcn,NTYPES,NOUT,&argc,&argv,lpj_usage);
 #ifdef USE_TIMING
   timing_stop(READCONFIG_FCN,t);
 #endif
   failonerror(&config,rc,READ_CONFIG_ERR,"Cannot read configuration");
+#if defined USE_MPI && defined USE_OPENMP
+  if(config.nthreads>1 && provided<MPI_THREAD_FUNNELED)
+  {
+    if(isroot(config))
+      fputs("WARNING046: MPI library does not support threads, number of threads set to one.\n",stderr);
+    config.nthreads=1;
+  }
+#endif
+#if defined USE_MPI && defined USE_PTHREAD
+  if(config.async_output && provided<MPI_THREAD_FUNNELED)
+  {
+    if(isroot(config))
+      fputs("WARNING054: MPI library does not support threads, output is written synchronously.\n",stderr);
+    config.async_output=FALSE;
+  }
+#endif
   if(argc)
   {
     if(isroot(config))
@@ -253,9 +277,12 @@ int main(int argc,char **argv)
   standtype[AGRICULTURE_GRASS]=agriculture_grass_stand;
   standtype[WOODPLANTATION]=woodplantation_stand;
   standtype[KILL]=kill_stand;
+  /* stands are taken from pool to avoid fragmentation of heap by land-use change */
+  if(initmempool(&standpool,sizeof(Stand),STANDPOOL_CHUNK,config.nthreads))
+    printallocerr("standpool");
   /* Allocation and initialization of grid */
 #ifdef USE_TIMING
-  timing_start(t);
+  timing_start(NEWGRID_FCN,t);
 #endif
   rc=((grid=newgrid(&config,standtype,NSTANDTYPES,config.npft[GRASS]+config.npft[TREE],config.npft[CROP]))==NULL);
 #ifdef USE_TIMING
@@ -269,7 +296,7 @@ int main(int argc,char **argv)
     failonerror(&config,rc,OPEN_COUPLER_ERR,s);
   }
 #ifdef USE_TIMING
-  timing_start(t);
+  timing_start(INITINPUT_FCN,t);
 #endif
   rc=initinput(&input,grid,config.npft[GRASS]+config.npft[TREE],config.npft[CROP],&config);
 #ifdef USE_TIMING
@@ -284,7 +311,7 @@ int main(int argc,char **argv)
   }
   /* open output files */  
 #ifdef USE_TIMING
-  timing_start(t);
+  timing_start(FOPENOUTPUT_FCN,t);
 #endif
   output=fopenoutput(grid,NOUT,&config);
 #ifdef USE_TIMING
@@ -294,7 +321,7 @@ int main(int argc,char **argv)
   failonerror(&config,rc,INIT_OUTPUT_ERR,
               "Initialization of output data failed");
 #ifdef USE_TIMING
-  timing_start(t);
+  timing_start(INITOUTPUT_FCN,t);
 #endif
   rc=initoutput(output,grid,config.npft[GRASS]+config.npft[TREE],config.npft[CROP],&config);
 #ifdef USE_TIMING
@@ -326,11 +353,18 @@ int main(int argc,char **argv)
   /* Simulation has finished */
   time(&tend); /* Stop timing */
   fcloseoutput(output,&config);
+  if(config.write_cost_filename!=NULL)
+  {
+    /* write measured cell costs for domain decomposition of subsequent runs */
+    if(!fwritecost(grid,config.write_cost_filename,&config) && isroot(config))
+      printf("Cell cost written to '%s'.\n",config.write_cost_filename);
+  }
   if(isroot(config))
     puts((year>config.lastyear) ? "Simulation ended." : "Simulation stopped.");
   /* free memory */
   freeinput(input,&config);
   freegrid(grid,config.npft[GRASS]+config.npft[TREE],&config);
+  freemempool(&standpool);
 #ifdef USE_MPI
   MPI_Reduce(&error_count,&error_count_total,1,MPI_INT,MPI_SUM,0,config.comm);
 #else
@@ -356,6 +390,11 @@ int main(int argc,char **argv)
 #ifdef USE_TIMING
   tfinal=mrun();
   printtiming(tfinal-tbegin,&config);
+  if(config.timing_filename!=NULL)
+  {
+    if(!fwritetiming(config.timing_filename,tfinal-tbegin,&config) && isroot(config))
+      printf("Timing report written to '%s'.\n",config.timing_filename);
+  }
 #endif
   freeconfig(&config);
 #ifdef USE_MPI
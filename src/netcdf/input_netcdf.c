@@ -24,6 +24,7 @@
 
 #endif
 #define checkptr(ptr) if(ptr==NULL) {printallocerr(#ptr); return TRUE; }
+#define NROWS_CACHE 16 /* number of latitude rows cached for unchunked data */
 
 struct input_netcdf
 {
@@ -36,6 +37,8 @@ struct input_netcdf
   size_t var_len;
   Type type;
   Bool is360;
+  size_t nrows;  /**< number of latitude rows in one cached band */
+  void **bands;  /**< cached bands of latitude rows, read on first access */
   union
   {
     Byte b;
@@ -80,6 +83,52 @@ static Bool checkinput(const size_t *offsets,const Coord *coord,const Input_netc
   }
   return FALSE;
 } /* of 'checkinput' */
+
+static int getvalues(const Input_netcdf input,
+                     const size_t *offsets, /**< offsets of cell in NetCDF file */
+                     int index,             /**< index of latitude in offsets */
+                     void *data             /**< data of type input->type */
+                    )                       /** \return NetCDF error code */
+{
+  /* Function copies var_len values for one cell from the band of latitude
+     rows cached in memory. The band is read by one call on first access, so
+     that compressed chunks are decompressed only once instead of for
+     every cell */
+  int rc;
+  size_t i,band,row,nrows,size;
+  size_t start[3],counts[3];
+  char *ptr;
+  band=offsets[index]/input->nrows;
+  nrows=min(input->nrows,input->lat_len-band*input->nrows);
+  size=typesizes[input->type];
+  if(input->bands[band]==NULL)
+  {
+    input->bands[band]=malloc(size*input->var_len*nrows*input->lon_len);
+    if(input->bands[band]==NULL)
+      return NC_ENOMEM;
+    if(index)
+    {
+      start[0]=0;
+      counts[0]=input->var_len;
+    }
+    start[index]=band*input->nrows;
+    counts[index]=nrows;
+    start[index+1]=0;
+    counts[index+1]=input->lon_len;
+    rc=nc_get_vara(input->ncid,input->varid,start,counts,input->bands[band]);
+    if(rc)
+    {
+      free(input->bands[band]);
+      input->bands[band]=NULL;
+      return rc;
+    }
+  }
+  row=offsets[index]-band*input->nrows;
+  ptr=input->bands[band];
+  for(i=0;i<input->var_len;i++)
+    memcpy((char *)data+i*size,ptr+((i*nrows+row)*input->lon_len+offsets[index+1])*size,size);
+  return NC_NOERR;
+} /* of 'getvalues' */
 #endif
 
 void closeinput(Infile *file)
@@ -93,11 +142,24 @@ void closeinput(Infile *file)
 Input_netcdf dupinput_netcdf(const Input_netcdf input)
 {
   Input_netcdf copy;
+  size_t i;
   copy=new(struct input_netcdf);
   if(copy==NULL)
     printallocerr("copy");
   else
+  {
     *copy=*input;
+    /* copy gets its own cache */
+    copy->bands=newvec(void *,(input->lat_len+input->nrows-1)/input->nrows);
+    if(copy->bands==NULL)
+    {
+      printallocerr("bands");
+      free(copy);
+      return NULL;
+    }
+    for(i=0;i<(input->lat_len+input->nrows-1)/input->nrows;i++)
+      copy->bands[i]=NULL;
+  }
   return copy;
 } /* of 'dupinput_netcdf' */
 
@@ -344,9 +406,10 @@ Input_netcdf openinput_netcdf(const Filename *filename, /**< filename */
 {
 #ifdef USE_NETCDF
   Input_netcdf input;
-  int rc,var_id,*dimids,ndims,index;
+  int rc,var_id,*dimids,ndims,index,storage;
   char name[NC_MAX_NAME+1];
   double *dim;
+  size_t *chunks,i;
   if(filename==NULL)
   {
     fputs("ERROR424: Invalid filename in openinput_netcdf().\n",stderr);
@@ -399,6 +462,21 @@ Input_netcdf openinput_netcdf(const Filename *filename, /**< filename */
     return NULL;
   }
   nc_inq_vardimid(input->ncid,input->varid,dimids);
+  chunks=newvec(size_t,ndims);
+  if(chunks==NULL)
+  {
+    printallocerr("chunks");
+    free(dimids);
+    nc_close(input->ncid);
+    free(input);
+    return NULL;
+  }
+  /* number of latitude rows cached is set to the chunk size of the file */
+  if(!nc_inq_var_chunking(input->ncid,input->varid,&storage,chunks) && storage==NC_CHUNKED)
+    input->nrows=chunks[index];
+  else
+    input->nrows=NROWS_CACHE;
+  free(chunks);
   nc_inq_dimname(input->ncid,dimids[index+1],name);
   rc=nc_inq_varid(input->ncid,name,&var_id);
   if(rc)
@@ -512,6 +590,17 @@ Input_netcdf openinput_netcdf(const Filename *filename, /**< filename */
     //return NULL;
   }
   free(dim);
+  input->nrows=max(1,min(input->nrows,input->lat_len));
+  input->bands=newvec(void *,(input->lat_len+input->nrows-1)/input->nrows);
+  if(input->bands==NULL)
+  {
+    printallocerr("bands");
+    nc_close(input->ncid);
+    free(input);
+    return NULL;
+  }
+  for(i=0;i<(input->lat_len+input->nrows-1)/input->nrows;i++)
+    input->bands[i]=NULL;
   return input;
 #else
   if(isroot(*config))
@@ -524,9 +613,13 @@ Input_netcdf openinput_netcdf(const Filename *filename, /**< filename */
 void closeinput_netcdf(Input_netcdf input)
 {
 #ifdef USE_NETCDF
+  size_t i;
   if(input!=NULL)
   {
     nc_close(input->ncid);
+    for(i=0;i<(input->lat_len+input->nrows-1)/input->nrows;i++)
+      free(input->bands[i]);
+    free(input->bands);
     free(input);
   }
 #endif
@@ -569,7 +662,6 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
   int index;
   size_t i;
   size_t offsets[3];
-  size_t counts[3]={1,1,1};
   String line;
   if(input==NULL || data==NULL)
   {
@@ -578,7 +670,6 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
   }
   if(input->var_len>1)
   {
-    counts[0]=input->var_len;
     offsets[0]=0;
     index=1;
   }
@@ -599,7 +690,7 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
     case LPJ_FLOAT:
       f=newvec(float,input->var_len);
       checkptr(f);
-      if((rc=nc_get_vara_float(input->ncid,input->varid,offsets,counts,f)))
+      if((rc=getvalues(input,offsets,index,f)))
       {
         fprintf(stderr,"ERROR415: Cannot read float data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -629,7 +720,7 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
     case LPJ_DOUBLE:
       d=newvec(double,input->var_len);
       checkptr(d);
-      if((rc=nc_get_vara_double(input->ncid,input->varid,offsets,counts,d)))
+      if((rc=getvalues(input,offsets,index,d)))
       {
         fprintf(stderr,"ERROR415: Cannot read double data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -659,7 +750,7 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
     case LPJ_INT:
       in=newvec(int,input->var_len);
       checkptr(in);
-      if((rc=nc_get_vara_int(input->ncid,input->varid,offsets,counts,in)))
+      if((rc=getvalues(input,offsets,index,in)))
       {
         fprintf(stderr,"ERROR415: Cannot read int data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -682,7 +773,7 @@ Bool readinput_netcdf(const Input_netcdf input,Real *data,
     case LPJ_SHORT:
       s=newvec(short,input->var_len);
       checkptr(s);
-      if((rc=nc_get_vara_short(input->ncid,input->varid,offsets,counts,s)))
+      if((rc=getvalues(input,offsets,index,s)))
       {
         fprintf(stderr,"ERROR434: Invalid value for cell (%s).\n",
                 sprintcoord(line,coord));
@@ -721,7 +812,6 @@ Bool readintinput_netcdf(const Input_netcdf input,int *data,
   float *f;
   size_t i;
   size_t offsets[3];
-  size_t counts[3]={1,1,1};
   String line;
   if(input==NULL || data==NULL)
   {
@@ -730,7 +820,6 @@ Bool readintinput_netcdf(const Input_netcdf input,int *data,
   }
   if(input->var_len>1)
   {
-    counts[0]=input->var_len;
     offsets[0]=0;
     index=1;
   }
@@ -750,7 +839,7 @@ Bool readintinput_netcdf(const Input_netcdf input,int *data,
   switch(input->type)
   {
     case LPJ_INT:
-      if((rc=nc_get_vara_int(input->ncid,input->varid,offsets,counts,data)))
+      if((rc=getvalues(input,offsets,index,data)))
       {
         fprintf(stderr,"ERROR415: Cannot read int data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -763,7 +852,7 @@ Bool readintinput_netcdf(const Input_netcdf input,int *data,
     case LPJ_SHORT:
       s=newvec(short,input->var_len);
       checkptr(s);
-      if((rc=nc_get_vara_short(input->ncid,input->varid,offsets,counts,s)))
+      if((rc=getvalues(input,offsets,index,s)))
       {
         fprintf(stderr,"ERROR415: Cannot read short data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -781,7 +870,7 @@ Bool readintinput_netcdf(const Input_netcdf input,int *data,
    case LPJ_FLOAT:
       f=newvec(float,input->var_len);
       checkptr(f);
-      if((rc=nc_get_vara_float(input->ncid,input->varid,offsets,counts,f)))
+      if((rc=getvalues(input,offsets,index,f)))
       {
         fprintf(stderr,"ERROR415: Cannot read float data for cell (%s): %s.\n",
                 sprintcoord(line,coord),nc_strerror(rc));
@@ -838,7 +927,11 @@ Bool readshortinput_netcdf(const Input_netcdf input,short *data,
     offsets[index+1]=(int)((coord->lon-input->lon_min)/input->lon_res+0.5);
   if(checkinput(offsets+index,coord,input))
     return TRUE;
-  if((rc=nc_get_vara_short(input->ncid,input->varid,offsets,counts,data)))
+  if(input->type==LPJ_SHORT)
+    rc=getvalues(input,offsets,index,data);
+  else
+    rc=nc_get_vara_short(input->ncid,input->varid,offsets,counts,data);
+  if(rc)
   {
     fprintf(stderr,"ERROR415: Cannot read short data for cell (%s): %s.\n",
             sprintcoord(line,coord),nc_strerror(rc));
@@ -182,6 +182,59 @@ Bool apply_finite_volume_diffusion_impl(Real * amount,          /**< g/m^2, subs
   return FALSE;
 } /* of 'apply_finite_volume_diffusion_of_a_day' */
 
+/* Batched variant of apply_finite_volume_diffusion_impl() for nsys independent
+ * systems sharing the same layer thicknesses. Amounts, diffusivities and porosities
+ * are interleaved, i.e. the value of layer j of system k is stored at index j*nsys+k. */
+Bool apply_finite_volume_diffusion_impl_batch(Real * amount,           /**< g/m^2, substance absolute amounts */
+                                              const int n,             /**< number of gridpoints */
+                                              const int nsys,          /**< number of systems */
+                                              const Real * h,          /**< m, layer thicknesses (delta_x), n values */
+                                              const Real * gas_con_air,/**< g/m^2, gas concentrations of substance, nsys values */
+                                              const Real * diff,       /**< m^2/s, diffusivities */
+                                              const Real * porosity,   /**< m^3/m^3, porosities */
+                                              const Real dt            /**< timestep */
+                                             )                         /** \return TRUE on error */
+{
+  Real res[n*nsys];          /* resistances */
+  Real gas_con_new[n*nsys];
+  Real a[n*nsys], b[n*nsys], c[n*nsys]; /* matrix diagonals */
+  Real rhs[n*nsys];          /* right hand side of the equation */
+  int j,k;
+
+  /* initialize work arrays, variable length arrays cannot be initialized in the declaration */
+  for (k=0; k<n*nsys; ++k)
+    a[k] = b[k] = c[k] = rhs[k] = gas_con_new[k] = 0;
+
+  /* calculate resistances, see calculate_resistances() */
+  for (k=0; k<nsys; ++k)
+    res[k] = (h[0]*0.5)/diff[k];
+  for (j=1; j<n; ++j)
+    for (k=j*nsys; k<(j+1)*nsys; ++k)
+      res[k] = (h[j-1]*0.5)/diff[k-nsys] + (h[j]*0.5)/diff[k];
+
+  /* arrange matrices and right hand sides with current gas concentrations, see arrange_matrix_fv() */
+  for (j=0; j<n; ++j)
+    for (k=j*nsys; k<(j+1)*nsys; ++k)
+    {
+      a[k] = - 1/res[k] * 1/(porosity[k] * h[j]) * dt;
+      c[k] = (j<n-1) ? - 1/res[k+nsys] * 1/(porosity[k] * h[j]) * dt : 0;
+      b[k] = 1 - a[k] - c[k];
+      rhs[k] = (amount[k] / h[j]) / porosity[k];
+    }
+  for (k=0; k<nsys; ++k)
+    rhs[k] = dt * gas_con_air[k]/(porosity[k] * h[0]) / res[k] + rhs[k];
+
+  /* Solve the equations A x = rhs, for x */
+  thomas_algorithm_batch(a, b, c, rhs, gas_con_new, n, nsys);
+
+  /* get back amounts */
+  for (j=0; j<n; ++j)
+    for (k=j*nsys; k<(j+1)*nsys; ++k)
+      amount[k] = gas_con_new[k] * porosity[k] * h[j];
+
+  return FALSE;
+} /* of 'apply_finite_volume_diffusion_impl_batch' */
+
 
 
 /* This function arranges the matrix for the implicit timestep.
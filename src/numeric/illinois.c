@@ -0,0 +1,102 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                 i  l  l  i  n  o  i  s  .  c                                   \n**/
+/**                                                                                \n**/
+/**     Finds a zero of a function using the Illinois regula falsi algorithm       \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "types.h"   /* Definition of datatype Real  */
+#include "hash.h"
+#include "bstruct.h"
+#include "numeric.h"
+
+Real illinois(Real (*fcn)(Real,void *), /**< function */
+              Real xlow,   /**< lower bound of interval */
+              Real xhigh,  /**< upper bound of interval */
+              Real xguess, /**< start value, e.g. solution of previous call */
+              Real dx,     /**< half width of initial bracket around start value */
+              void *data,  /**< pointer to additional data for function */
+              Real xacc,   /**< accuracy in x */
+              Real yacc,   /**< accuracy in y */
+              int maxit,   /**< maximum number of iterations */
+              int *it      /**< iterations performed */
+             )             /** \return position of zero of function */
+{
+  int i;
+  Bool up;
+  Real a,b,x,ya,yb,y,xmin,ymin;
+  if(xguess<xlow || xguess>xhigh)
+    xguess=(xlow+xhigh)*0.5;
+  ya=(*fcn)(xguess,data);
+  if(fabs(ya)<yacc)
+  {
+    *it=0;
+    return xguess;
+  }
+  a=xmin=xguess;
+  ymin=fabs(ya);
+  /* try narrow bracket around start value first, downwards if start value is upper bound */
+  up=(xguess<xhigh);
+  b=(up) ? min(xguess+dx,xhigh) : max(xguess-dx,xlow);
+  yb=(*fcn)(b,data);
+  if(ya*yb>0)
+  {
+    /* no sign change, go straight to bound of interval where function approaches zero */
+    if(fabs(yb)>=ymin && up && xguess>xlow)
+      x=xlow;
+    else
+    {
+      x=(up) ? xhigh : xlow;
+      a=b;
+      ya=yb;
+    }
+    b=x;
+    yb=(*fcn)(b,data);
+    if(ya*yb>0)
+    {
+      /* no zero bracketed, bisection returns best approximation */
+      return bisect(fcn,xlow,xhigh,data,xacc,yacc,maxit,it);
+    }
+  }
+  if(fabs(yb)<ymin)
+  {
+    ymin=fabs(yb);
+    xmin=b;
+  }
+  for(i=0;i<maxit;i++)
+  {
+    if(fabs(yb)<yacc || fabs(b-a)<xacc)
+    {
+      *it=i;
+      return b;
+    }
+    /* secant step within bracket [a,b] */
+    x=b-yb*(b-a)/(yb-ya);
+    y=(*fcn)(x,data);
+    if(fabs(y)<ymin)
+    {
+      ymin=fabs(y);
+      xmin=x;
+    }
+    if(y*yb<0)
+    {
+      a=b;
+      ya=yb;
+    }
+    else
+      ya*=0.5; /* Illinois modification avoids retaining the same end point */
+    b=x;
+    yb=y;
+  } /* of for */
+  *it=i;
+  return xmin;
+} /* of 'illinois' */
@@ -0,0 +1,56 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                    thomas_algorithm_batch.c                                    \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+/* This function performs the standard thomas algorithm for nsys independent
+   tridiagonal systems of size n. The systems are interleaved, i.e. element i
+   of system k is stored at index i*nsys+k, so that the inner loops over the
+   systems access consecutive memory and can be vectorized. */
+void thomas_algorithm_batch(const Real *a, /**< sub diagonal elements */
+                            const Real *b, /**< main diagonal elements */
+                            const Real *c, /**< super diagonal elements */
+                            const Real *d, /**< right hand side */
+                            Real *x,       /**< solution */
+                            const int n,   /**< number of grid points */
+                            const int nsys /**< number of systems */
+                           )
+{
+  Real c_prime[n*nsys];
+  Real d_prime[n*nsys];
+  int i,k;
+
+  /* modify coefficients by progressing in forward direction */
+  /* this codes eliminiates the sub diagnal a an norms the diagonal b 1 */
+  for (k=0; k<nsys; k++)
+  {
+    c_prime[k] = c[k] / b[k];
+    d_prime[k] = d[k] / b[k];
+  }
+  for (i=1; i<n-1; i++)
+    for (k=i*nsys; k<(i+1)*nsys; k++)
+      c_prime[k] = c[k] / (b[k] - a[k] * c_prime[k-nsys]);
+  /* last row has no super diagonal element */
+  for (k=(n-1)*nsys; k<n*nsys; k++)
+    c_prime[k] = 0;
+
+  for (i=1; i<n; i++)
+    for (k=i*nsys; k<(i+1)*nsys; k++)
+      d_prime[k] = (d[k] - a[k] * d_prime[k-nsys]) / (b[k] - a[k] * c_prime[k-nsys]);
+
+  /* back substitution */
+  for (k=(n-1)*nsys; k<n*nsys; k++)
+    x[k] = d_prime[k];
+  for (i = n-2; i>=0; i--)
+    for (k=i*nsys; k<(i+1)*nsys; k++)
+      x[k] = d_prime[k] - c_prime[k] * x[k+nsys];
+} /* of 'thomas_algorithm_batch' */
@@ -42,6 +42,8 @@ Pnet *pnet_dup(const Pnet *pnet
 #ifdef USE_MPI
   ret->type=pnet->type;
   ret->comm=pnet->comm;
+  ret->nreq=0;
+  ret->req=NULL;
 #else
   ret->size=pnet->size;
 #endif
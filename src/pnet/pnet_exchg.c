@@ -0,0 +1,45 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                     p  n  e  t  _  e  x  c  h  g  .  c                         \n**/
+/**                                                                                \n**/
+/**     MPI-parallelization of networks                                            \n**/
+/**                                                                                \n**/
+/**     Function exchanges data between neighbouring tasks of the                  \n**/
+/**     distributed network. Only tasks sharing connections communicate            \n**/
+/**     using the persistent requests created by pnet_setup().                     \n**/
+/**                                                                                \n**/
+/**     Implementation is described in:                                            \n**/
+/**     W. von Bloh, 2008. Sequential and Parallel Implementation of               \n**/
+/**     Networks. In P. beim Graben, C. Zhou, M. Thiel, and J. Kurths              \n**/
+/**     (eds.), Lectures in Supercomputational Neuroscience, Dynamics in           \n**/
+/**     Complex Brain Networks, Springer, 279-318.                                 \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+#include "types.h"
+#include "pnet.h"
+
+#ifdef USE_MPI
+
+void pnet_exchg(Pnet *pnet /**< Pointer to Pnet structure */
+               )           /** \return void */
+{
+  if(pnet->nreq)
+  {
+    MPI_Startall(pnet->nreq,pnet->req);
+    MPI_Waitall(pnet->nreq,pnet->req,MPI_STATUSES_IGNORE);
+  }
+} /* of 'pnet_exchg' */
+
+#endif
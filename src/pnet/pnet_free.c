@@ -33,6 +33,11 @@ void pnet_free(Pnet *pnet)
   int i;
   if(pnet!=NULL)
   {
+#ifdef USE_MPI
+    for(i=0;i<pnet->nreq;i++)
+      MPI_Request_free(pnet->req+i);
+    free(pnet->req);
+#endif
     free(pnet->outdisp);
     free(pnet->indisp);
     free(pnet->outlen);
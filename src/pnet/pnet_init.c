@@ -36,6 +36,9 @@ Pnet *pnet_init(
                 int size,          /**< size of grid element */
 #endif
                 int n /**< size of grid */
+#ifdef USE_MPI
+               ,const int counts[] /**< number of grid elements of each task or NULL */
+#endif
                )      /** \return initialized pnet structure or NULL */
 {
   int slice,rem,i;
@@ -57,6 +60,8 @@ Pnet *pnet_init(
   MPI_Comm_rank(comm,&pnet->taskid);
   pnet->type=type;
   pnet->comm=comm;
+  pnet->nreq=0;
+  pnet->req=NULL;
 #else
   /* sequential code */
   pnet->ntask=1;
@@ -84,6 +89,16 @@ Pnet *pnet_init(
     pnet->lo+=rem;
     pnet->hi+=rem;
   }
+#ifdef USE_MPI
+  if(counts!=NULL)
+  {
+    /* use given distribution of grid elements on tasks */
+    pnet->lo=0;
+    for(i=0;i<pnet->taskid;i++)
+      pnet->lo+=counts[i];
+    pnet->hi=pnet->lo+counts[pnet->taskid]-1;
+  }
+#endif
   /* allocate memory for connection list array */
   pnet->connect=newvec2(Intlist,pnet->lo,pnet->hi);
   if(pnet->connect==NULL) /* was memory allocation successful? */
@@ -45,15 +45,13 @@ int pnet_reverse(Pnet *pnet /**< Pointer to Pnet structure */
                 )           /** \return error code        */
 {
   int *lo,*hi;
-  int i,j,size,slice,rem,task,outsize,rc;
+  int i,j,size,task,outsize,rc;
   data_t *in,*out;
 #ifdef USE_MPI
   MPI_Datatype type;
 #endif
   if(pnet==NULL)
     return PNET_NULL_PTR_ERR;
-  slice=pnet->n/pnet->ntask;
-  rem=pnet->n % pnet->ntask;
   lo=newvec(int,pnet->ntask);
   if(lo==NULL)
     return PNET_ALLOC_ERR;
@@ -63,22 +61,14 @@ int pnet_reverse(Pnet *pnet /**< Pointer to Pnet structure */
     free(lo);
     return PNET_ALLOC_ERR;
   }
-   /* calculate lower and upper bounds for all tasks */
-  for(i=0;i<pnet->ntask;i++)
-  {
-    lo[i]=i*slice;
-    hi[i]=(i+1)*slice-1;
-    if(i<rem)
-    {
-       lo[i]+=i;
-       hi[i]+=i+1;
-    }
-    else
-    {
-      lo[i]+=rem;
-      hi[i]+=rem;
-    }
-  }
+  /* get lower and upper bounds of all tasks */
+#ifdef USE_MPI
+  MPI_Allgather(&pnet->lo,1,MPI_INT,lo,1,MPI_INT,pnet->comm);
+  MPI_Allgather(&pnet->hi,1,MPI_INT,hi,1,MPI_INT,pnet->comm);
+#else
+  lo[0]=pnet->lo;
+  hi[0]=pnet->hi;
+#endif
   for(i=0;i<pnet->ntask;i++)
     pnet->outlen[i]=pnet->inlen[i]=0;
   /* determine total length of connection lists */
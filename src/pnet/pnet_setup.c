@@ -6,8 +6,8 @@
 /**                                                                                \n**/
 /**     Function initializes communication pattern necessary for the               \n**/
 /**     distributed network. This is the core function for the Pnet                \n**/
-/**     library. Data have to be exchanged by incoking the pnet_exchg              \n**/
-/**     macro.                                                                     \n**/
+/**     library. Data have to be exchanged by invoking pnet_exchg().               \n**/
+/**     Persistent requests are created for neighbouring tasks only.               \n**/
 /**                                                                                \n**/
 /**     Implementation is described in:                                            \n**/
 /**     W. von Bloh, 2008. Sequential and Parallel Implementation of               \n**/
@@ -43,15 +43,13 @@ int pnet_setup(Pnet *pnet /**< Pointer to Pnet structure */
               )           /** \return error code        */
 {
   int *lo,*hi;
-  int i,j,k,*index,*in,size,slice,rem,task,insize;
+  int i,j,k,*index,*in,size,task,insize;
 #ifdef USE_MPI
   MPI_Aint lb;
   MPI_Aint extent;
 #endif
   if(pnet==NULL)
     return PNET_NULL_PTR_ERR;
-  slice=pnet->n/pnet->ntask;
-  rem=pnet->n % pnet->ntask;
   lo=newvec(int,pnet->ntask);
   if(lo==NULL)
     return PNET_ALLOC_ERR;
@@ -61,22 +59,14 @@ int pnet_setup(Pnet *pnet /**< Pointer to Pnet structure */
     free(lo);
     return PNET_ALLOC_ERR;
   }
-  /* calculate lower and upper bounds for all tasks */
-  for(i=0;i<pnet->ntask;i++)
-  {
-    lo[i]=i*slice;
-    hi[i]=(i+1)*slice-1;
-    if(i<rem)
-    {
-       lo[i]+=i;
-       hi[i]+=i+1;
-    }
-    else
-    {
-      lo[i]+=rem;
-      hi[i]+=rem;
-    }
-  }
+  /* get lower and upper bounds of all tasks */
+#ifdef USE_MPI
+  MPI_Allgather(&pnet->lo,1,MPI_INT,lo,1,MPI_INT,pnet->comm);
+  MPI_Allgather(&pnet->hi,1,MPI_INT,hi,1,MPI_INT,pnet->comm);
+#else
+  lo[0]=pnet->lo;
+  hi[0]=pnet->hi;
+#endif
   for(i=0;i<pnet->ntask;i++)
     pnet->outlen[i]=pnet->inlen[i]=0;
   /* determine total length of connection lists */
@@ -217,5 +207,31 @@ int pnet_setup(Pnet *pnet /**< Pointer to Pnet structure */
   free(in);
   free(lo);
   free(hi);
-  return (pnet->outbuffer==NULL || pnet->inbuffer==NULL) ? PNET_ALLOC_ERR : PNET_OK;
+  if(pnet->outbuffer==NULL || pnet->inbuffer==NULL)
+    return PNET_ALLOC_ERR;
+#ifdef USE_MPI
+  /* create persistent requests only for tasks sharing connections */
+  for(i=0;i<pnet->nreq;i++)
+    MPI_Request_free(pnet->req+i);
+  free(pnet->req);
+  pnet->nreq=0;
+  for(i=0;i<pnet->ntask;i++)
+    pnet->nreq+=(pnet->inlen[i]>0)+(pnet->outlen[i]>0);
+  pnet->req=newvec(MPI_Request,pnet->nreq);
+  if(pnet->req==NULL && pnet->nreq>0)
+  {
+    pnet->nreq=0;
+    return PNET_ALLOC_ERR;
+  }
+  k=0;
+  for(i=0;i<pnet->ntask;i++)
+    if(pnet->inlen[i]>0)
+      MPI_Recv_init((char *)pnet->inbuffer+extent*pnet->indisp[i],pnet->inlen[i],
+                    pnet->type,i,0,pnet->comm,pnet->req+k++);
+  for(i=0;i<pnet->ntask;i++)
+    if(pnet->outlen[i]>0)
+      MPI_Send_init((char *)pnet->outbuffer+extent*pnet->outdisp[i],pnet->outlen[i],
+                    pnet->type,i,0,pnet->comm,pnet->req+k++);
+#endif
+  return PNET_OK;
 } /* of 'pnet_setup' */
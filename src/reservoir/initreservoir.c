@@ -237,7 +237,7 @@ Bool initreservoir(Cell grid[],   /**< LPJ grid */
   check(counts);
   offsets=newvec(int,config->ntask);
   check(offsets);
-  getcounts(counts,offsets,config->nall,2,config->ntask);
+  getgridcounts(counts,offsets,2,config);
 #endif
   recv=newvec(Item,config->nall);
   check(recv);
@@ -266,7 +266,7 @@ Bool initreservoir(Cell grid[],   /**< LPJ grid */
 #ifdef USE_MPI
   config->irrig_res=pnet_init(config->comm,
                                    (sizeof(Real)==sizeof(double)) ? MPI_DOUBLE : MPI_FLOAT,
-                                   config->nall);
+                                   config->nall,config->cellcounts);
 #else
   config->irrig_res=pnet_init(sizeof(Real),config->nall);
 #endif
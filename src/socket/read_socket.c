@@ -27,14 +27,19 @@ Bool read_socket(Socket *socket,void *data,int n)
   int i,j;
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(READ_SOCKET_FCN,tstart);
 #endif
   i=n;
   do
   {
     j=recv(socket->channel,(char *)data+n-i,i,0);
     if(j<0)
+    {
+#ifdef USE_TIMING
+      timing_stop(READ_SOCKET_FCN,tstart);
+#endif
       return TRUE;
+    }
     i-=j;
   }while(i);
 #ifdef USE_TIMING
@@ -30,13 +30,18 @@ Bool write_socket(Socket *socket,const void *buffer,int n)
   int i,j;
   i=0;
 #ifdef USE_TIMING
-  timing_start(tstart);
+  timing_start(WRITE_SOCKET_FCN,tstart);
 #endif
   do
   {
     j=send(socket->channel,(char *)buffer+i,n,0);
     if(j<0)
+    {
+#ifdef USE_TIMING
+      timing_stop(WRITE_SOCKET_FCN,tstart);
+#endif
       return TRUE;
+    }
     i+=j;
     n-=j;
   }while(n);
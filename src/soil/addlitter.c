@@ -20,9 +20,14 @@ int addlitter(Litter *litter,    /**< pointer to litter */
               )                  /** \return PFT-specific above ground litter pool */
 {
   int i;
-  litter->item=(Litteritem *)realloc(litter->item,
-                                     sizeof(Litteritem)*(litter->n+1));
-  check(litter->item);
+  if(litter->n==litter->size)
+  {
+    /* double size of litter array to avoid reallocation for each litter pool added */
+    litter->size=(litter->size==0) ? 1 : 2*litter->size;
+    litter->item=(Litteritem *)realloc(litter->item,
+                                       sizeof(Litteritem)*litter->size);
+    check(litter->item);
+  }
   litter->item[litter->n].pft=pft;
   litter->item[litter->n].agtop.leaf.carbon=0;
   litter->item[litter->n].agtop.leaf.nitrogen=0;
@@ -0,0 +1,391 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                    apply_heatconduction_of_a_day_batch.c                       \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+/*
+
+ * This function is the batched variant of apply_heatconduction_of_a_day().
+ * It advances the enthalpy vectors of many stands over the span of a day.
+ * All arrays hold NHEATGRIDP rows with the stand index innermost, i.e.
+ * enth[j*size+s] is the enthalpy of gridpoint j of stand s.
+ * Stands are processed in chunks of HEATBATCH stands that are copied into
+ * contiguous local arrays. All loops over the stands of a chunk have a fixed
+ * length and no data dependencies, so that they can be vectorized.
+ * Within a chunk the implicit temperature scheme is applied to all stands with
+ * uniform temperature signs and the explicit enthalpy scheme to all stands with
+ * mixed signs. In the enthalpy scheme each stand keeps its own number of timesteps,
+ * stands that have finished are continued with zero timestep, which leaves the
+ * enthalpy unchanged. Unused lanes of a chunk are padded with unit properties.
+ * The arithmetic is the same as in apply_heatconduction_of_a_day(), hence
+ * the results agree with the scalar function up to rounding.
+
+*/
+
+#include "lpj.h"
+
+#define HEATBATCH 8 /* number of stands solved together */
+#define MAXTIMESTEP 1000
+
+typedef struct
+{
+  Real lam_frozen[NHEATGRIDP][HEATBATCH];
+  Real lam_unfrozen[NHEATGRIDP][HEATBATCH];
+  Real c_frozen[NHEATGRIDP][HEATBATCH];
+  Real c_unfrozen[NHEATGRIDP][HEATBATCH];
+  Real latent_heat[NHEATGRIDP][HEATBATCH];
+} Thermal_batch;
+
+/* declare internally used functions */
+STATIC void use_enth_scheme_batch(Real [][HEATBATCH], Real [][HEATBATCH], const Real *, const Thermal_batch *, const Bool *);
+STATIC void use_temp_scheme_implicit_batch(Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH]);
+STATIC void timestep_implicit_batch(Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real);
+STATIC void arrange_matrix_batch(Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real [][HEATBATCH], Real);
+
+/******** main function *********/
+void apply_heatconduction_of_a_day_batch(int n,                                      /**< number of stands */
+                                         int size,                                   /**< leading dimension of arrays (size>=n) */
+                                         const Uniform_temp_sign *uniform_temp_sign, /**< flags to indicate if the temperatures of a stand all have the same signs */
+                                         Real *enth,                                 /**< enthalpies that the method is updating (excluding gridpoint at surface) (J/m3) */
+                                         const Real *h,                              /**< distances between adjacent gridpoints (m) */
+                                         const Real *temp_top,                       /**< temperatures of the ground surface (GST), (dirichlet boundary condition) */
+                                         const Soil_thermal_prop_batch *th           /**< thermal properties of soils (thermal conductivity, heat capacity, latent heat) */
+                                        )
+{
+  Real enth_b[NHEATGRIDP][HEATBATCH];      /* enthalpies of chunk */
+  Real h_b[NHEATGRIDP][HEATBATCH];         /* distances between adjacent gridpoints of chunk */
+  Real temp[NHEATGRIDP+1][HEATBATCH];      /* temperatures of chunk (including surface gridpoint with index 0) */
+  Real hcap[NHEATGRIDP][HEATBATCH];        /* heat capacities selected for temperature scheme */
+  Real lam[NHEATGRIDP][HEATBATCH];         /* thermal conductivities selected for temperature scheme */
+  Real latent_heat[NHEATGRIDP][HEATBATCH]; /* latent heat selected for temperature scheme */
+  Thermal_batch th_b;                      /* thermal properties for enthalpy scheme */
+  Real top[HEATBATCH];
+  Bool isuniform[HEATBATCH],ismixed[HEATBATCH];
+  Bool any_uniform,any_mixed;
+  int s0,s,nb,j,k;
+
+  for(s0=0;s0<n;s0+=HEATBATCH)
+  {
+    nb=min(n-s0,HEATBATCH);
+    any_uniform=any_mixed=FALSE;
+    for(s=0;s<HEATBATCH;s++)
+    {
+      isuniform[s]=ismixed[s]=FALSE;
+      if(s>=nb)
+        continue;
+      switch(uniform_temp_sign[s0+s])
+      {
+        case ALL_ABOVE_0: case ALL_BELOW_0:
+          isuniform[s]=any_uniform=TRUE;
+          break;
+        case MIXED_SIGN:
+          ismixed[s]=any_mixed=TRUE;
+          break;
+        default:
+          fail(INVALID_TEMP_SIGN_ERR,TRUE,FALSE,"uniform_temp_sign=%d of stand %d is not one of the three possible values",
+               uniform_temp_sign[s0+s],s0+s);
+      }
+    }
+
+    /* copy chunk into contiguous arrays */
+    for(j=0;j<NHEATGRIDP;j++)
+    {
+      k=j*size+s0;
+      for(s=0;s<nb;s++)
+      {
+        enth_b[j][s]=enth[k+s];
+        h_b[j][s]=h[k+s];
+      }
+      for(s=nb;s<HEATBATCH;s++)
+      {
+        enth_b[j][s]=0;
+        h_b[j][s]=1;
+      }
+    }
+    for(s=0;s<HEATBATCH;s++)
+      top[s]=(s<nb) ? temp_top[s0+s] : 0;
+
+    if(any_uniform)
+    {
+      /* temperature scheme can be used with frozen or unfrozen soil props */
+      for(j=0;j<NHEATGRIDP;j++)
+      {
+        k=j*size+s0;
+        for(s=0;s<HEATBATCH;s++)
+          if(isuniform[s] && uniform_temp_sign[s0+s]==ALL_ABOVE_0)
+          {
+            hcap[j][s]=th->c_unfrozen[k+s];
+            lam[j][s]=th->lam_unfrozen[k+s];
+            latent_heat[j][s]=th->latent_heat[k+s];
+          }
+          else if(isuniform[s])
+          {
+            hcap[j][s]=th->c_frozen[k+s];
+            lam[j][s]=th->lam_frozen[k+s];
+            latent_heat[j][s]=0;
+          }
+          else
+          {
+            hcap[j][s]=lam[j][s]=1;
+            latent_heat[j][s]=0;
+          }
+      }
+
+      /* get temperatures corresponding to the enthalpies */
+      for(s=0;s<HEATBATCH;s++)
+        temp[0][s]=top[s]; /* assign dirichlet boundary condition */
+      for(j=0;j<NHEATGRIDP;j++)
+        for(s=0;s<HEATBATCH;s++)
+          temp[j+1][s]=(enth_b[j][s]-latent_heat[j][s])/hcap[j][s];
+
+      /* update temperature */
+      use_temp_scheme_implicit_batch(temp,h_b,hcap,lam);
+
+      /* get back the enthalpies corresponding to the updated temperatures */
+      for(j=0;j<NHEATGRIDP;j++)
+        for(s=0;s<HEATBATCH;s++)
+          if(isuniform[s])
+            enth_b[j][s]=temp[j+1][s]*hcap[j][s]+latent_heat[j][s];
+    }
+
+    if(any_mixed)
+    {
+      /* enthalpy scheme has to be used */
+      for(j=0;j<NHEATGRIDP;j++)
+      {
+        k=j*size+s0;
+        for(s=0;s<HEATBATCH;s++)
+          if(ismixed[s])
+          {
+            th_b.lam_frozen[j][s]=th->lam_frozen[k+s];
+            th_b.lam_unfrozen[j][s]=th->lam_unfrozen[k+s];
+            th_b.c_frozen[j][s]=th->c_frozen[k+s];
+            th_b.c_unfrozen[j][s]=th->c_unfrozen[k+s];
+            th_b.latent_heat[j][s]=th->latent_heat[k+s];
+          }
+          else
+          {
+            th_b.lam_frozen[j][s]=th_b.lam_unfrozen[j][s]=1;
+            th_b.c_frozen[j][s]=th_b.c_unfrozen[j][s]=1;
+            th_b.latent_heat[j][s]=0;
+          }
+      }
+      use_enth_scheme_batch(enth_b,h_b,top,&th_b,ismixed);
+    }
+
+    /* copy back chunk */
+    for(j=0;j<NHEATGRIDP;j++)
+    {
+      k=j*size+s0;
+      for(s=0;s<nb;s++)
+        enth[k+s]=enth_b[j][s];
+    }
+  }
+} /* of 'apply_heatconduction_of_a_day_batch' */
+
+
+/******** underlying numerical methods ********/
+
+/* The function applies the explicit enthalpy scheme to all active stands of a chunk,
+ * see use_enth_scheme() in apply_heatconduction_of_a_day.c */
+STATIC void use_enth_scheme_batch(Real enth[][HEATBATCH],
+                                  Real h[][HEATBATCH],
+                                  const Real *temp_top,
+                                  const Thermal_batch *th,
+                                  const Bool *isactive
+                                 )
+{
+  Real temp[NHEATGRIDP+1][HEATBATCH];                                       /* temperature array (including surface gridpoint with index 0) */
+  Real lam_fro_dBh[NHEATGRIDP][HEATBATCH], lam_unfro_dBh[NHEATGRIDP][HEATBATCH]; /* thermal conducitivity divided by gridpoint distances */
+  Real inv_c_fro[NHEATGRIDP][HEATBATCH], inv_c_unfro[NHEATGRIDP][HEATBATCH];     /* inverses of frozen and unfrozen heat capacities */
+  Real inv_element_midpoint_dist[NHEATGRIDP][HEATBATCH];                   /* inverse of the distances between the midpoints of adjacent elements */
+  Real QQ[NHEATGRIDP+1][HEATBATCH];                                         /* heatflux from gp j to gp j+1 */
+  Real dt[HEATBATCH];        /* timesteps */
+  Real dt_active[HEATBATCH]; /* timesteps, zero for stands that have finished */
+  Real dt_inv[HEATBATCH];
+  Real h_inv,dt_inv_temporary;
+  int timesteps[HEATBATCH],maxtimesteps;
+  int j,s,timestp;
+
+  /* --- precompute some values for better performance --- */
+  for(j=0;j<NHEATGRIDP;j++)
+    for(s=0;s<HEATBATCH;s++)
+    {
+      h_inv=1/h[j][s];
+      lam_fro_dBh[j][s]=th->lam_frozen[j][s]*h_inv;
+      lam_unfro_dBh[j][s]=th->lam_unfrozen[j][s]*h_inv;
+      inv_c_fro[j][s]=1/th->c_frozen[j][s];
+      inv_c_unfro[j][s]=1/th->c_unfrozen[j][s];
+      inv_element_midpoint_dist[j][s]=2/(h[j][s]+(j<NHEATGRIDP-1 ? h[j+1][s] : 0.0));
+    }
+
+  /* --- calulate max possible timestep for each stand --- */
+  for(s=0;s<HEATBATCH;s++)
+    dt_inv[s]=0;
+  for(j=0;j<NHEATGRIDP;j++)
+    for(s=0;s<HEATBATCH;s++)
+    {
+      dt_inv_temporary=max((lam_unfro_dBh[j][s]+(j<NHEATGRIDP-1 ? lam_unfro_dBh[j+1][s] : 0.0))*inv_c_unfro[j][s],
+                           (lam_fro_dBh[j][s]  +(j<NHEATGRIDP-1 ? lam_fro_dBh[j+1][s]   : 0.0))*inv_c_fro[j][s])
+                       *inv_element_midpoint_dist[j][s];
+      if(dt_inv[s]<dt_inv_temporary)
+        dt_inv[s]=dt_inv_temporary;
+    }
+  maxtimesteps=0;
+  for(s=0;s<HEATBATCH;s++)
+  {
+    if(!isactive[s])
+    {
+      timesteps[s]=0;
+      dt[s]=0;
+      continue;
+    }
+    if(dt_inv[s]>MAXTIMESTEP)
+    {
+      for(j=0;j<NHEATGRIDP;j++)
+        fprintf(stderr,"problems in use_enth_scheme dt_inv:%g inv_c_unfro=%g inv_c_fro=%g lam_unfro_dBh=%g lam_fro_dBh=%g \n",
+                dt_inv[s],inv_c_unfro[j][s],inv_c_fro[j][s],lam_unfro_dBh[j][s],lam_fro_dBh[j][s]);
+      dt_inv[s]=MAXTIMESTEP;
+    }
+#ifdef SAFE
+    if(isnan(dt_inv[s]))
+      fail(INVALID_TIMESTEP_ERR,TRUE,FALSE,"Invalid time step in %s",__FUNCTION__);
+#endif
+    timesteps[s]=(int)(day2sec(dt_inv[s]))+1; /* get number timesteps that ensures small enough timestep */
+    dt[s]=day2sec(1.0/timesteps[s]);          /* final timestep */
+    if(maxtimesteps<timesteps[s])
+      maxtimesteps=timesteps[s];
+  }
+
+  /* --- main timestepping loop --- */
+  for(s=0;s<HEATBATCH;s++)
+  {
+    QQ[NHEATGRIDP][s]=0;   /* it is intended that the last value of QQ stays at zero during timestepping */
+    temp[0][s]=temp_top[s]; /* assign dirichlet boundary condition */
+  }
+  for(timestp=0;timestp<maxtimesteps;++timestp)
+  {
+    for(s=0;s<HEATBATCH;s++)
+      dt_active[s]=(timestp<timesteps[s]) ? dt[s] : 0;
+
+    /* calculate gridpoint temperatures from gridpoint enthalpies */
+    for(j=0;j<NHEATGRIDP;j++)
+      for(s=0;s<HEATBATCH;s++)
+        temp[j+1][s]=(enth[j][s]<0                     ?  enth[j][s]                         *inv_c_fro[j][s]   : 0)+
+                     (enth[j][s]>th->latent_heat[j][s] ? (enth[j][s]-th->latent_heat[j][s])*inv_c_unfro[j][s] : 0);
+
+    /* calculate heat fluxes from temperature difference */
+    for(j=0;j<NHEATGRIDP;j++)
+      for(s=0;s<HEATBATCH;s++)
+        QQ[j][s]=-(temp[j+1][s]*(temp[j+1][s]<0 ? lam_fro_dBh[j][s] : lam_unfro_dBh[j][s])-
+                   temp[j][s]  *(temp[j][s]  <0 ? lam_fro_dBh[j][s] : lam_unfro_dBh[j][s]));
+
+    /* calculate and apply enthalpy update */
+    for(j=0;j<NHEATGRIDP;j++)
+      for(s=0;s<HEATBATCH;s++)
+        enth[j][s]=enth[j][s]+dt_active[s]*(QQ[j][s]-QQ[j+1][s])*inv_element_midpoint_dist[j][s];
+  }
+} /* of 'use_enth_scheme_batch' */
+
+/* The function applies the implicit temperature scheme to all stands of a chunk */
+STATIC void use_temp_scheme_implicit_batch(Real temp[][HEATBATCH],
+                                           Real h[][HEATBATCH],
+                                           Real hcap[][HEATBATCH],
+                                           Real lam[][HEATBATCH]
+                                          )
+{
+  int i,steps;
+  /* determine number of timesteps to be performed for the day
+   * for non unit testing it is just 1 */
+#ifdef U_TEST
+  steps=GPLHEAT; /* high res value */
+#else
+  steps=1; /* default value (on timestep per day) */
+#endif
+  Real dt=day2sec(1.0/steps);
+
+  /* do implicit timestepping */
+  for(i=0;i<steps;i++)
+    timestep_implicit_batch(temp,h,hcap,lam,dt);
+} /* of 'use_temp_scheme_implicit_batch' */
+
+/* This function peforms a single implicit timestep of the temperature scheme
+ * for all stands of a chunk, see timestep_implicit() */
+STATIC void timestep_implicit_batch(Real temp[][HEATBATCH],
+                                    Real h[][HEATBATCH],
+                                    Real hcap[][HEATBATCH],
+                                    Real lam[][HEATBATCH],
+                                    Real dt
+                                   )
+{
+  Real sub[NHEATGRIDP][HEATBATCH];   /* sub diagonal elements */
+  Real maind[NHEATGRIDP][HEATBATCH]; /* main diagonal elements */
+  Real sup[NHEATGRIDP][HEATBATCH];   /* super diagonal elements */
+  Real rhs[NHEATGRIDP][HEATBATCH];   /* right-hand side */
+  int j,s;
+
+  /* --- arrange matrix --- */
+  arrange_matrix_batch(sub,maind,sup,h,hcap,lam,dt);
+
+  /* --- compute right-hand side ---  */
+  for(s=0;s<HEATBATCH;s++)
+    rhs[0][s]=temp[1][s]*(2-maind[0][s])-temp[2][s]*sup[0][s];
+  for(j=1;j<NHEATGRIDP-1;j++)
+    for(s=0;s<HEATBATCH;s++)
+      rhs[j][s]=temp[j+1][s]*(2-maind[j][s])-temp[j][s]*sub[j][s]-temp[j+2][s]*sup[j][s];
+  for(s=0;s<HEATBATCH;s++)
+  {
+    rhs[NHEATGRIDP-1][s]=temp[NHEATGRIDP][s]*(2-maind[NHEATGRIDP-1][s])-temp[NHEATGRIDP-1][s]*sub[NHEATGRIDP-1][s];
+    /* add vector L */
+    rhs[0][s]-=2*temp[0][s]*sub[0][s];
+  }
+
+  /* --- solve tridiagonal systems with the thomas algorithm --- */
+  thomas_algorithm_batch(sub[0],maind[0],sup[0],rhs[0],temp[1],NHEATGRIDP,HEATBATCH);
+} /* of 'timestep_implicit_batch' */
+
+/* This function arranges the matrices for the implicit timestep, see arrange_matrix() */
+STATIC void arrange_matrix_batch(Real a[][HEATBATCH],    /* sub diagonal elements  */
+                                 Real b[][HEATBATCH],    /* main diagonal elements */
+                                 Real c[][HEATBATCH],    /* super diagonal elements */
+                                 Real h[][HEATBATCH],    /* distances between adjacent gridpoints  */
+                                 Real hcap[][HEATBATCH], /* heat capacities */
+                                 Real lam[][HEATBATCH],  /* thermal conductivities */
+                                 Real dt                 /* timestep */
+                                )
+{
+  Real lam_divBy_h[NHEATGRIDP][HEATBATCH]; /* thermal conducitivity divided by gridpoint distances */
+  Real inv_element_midpoint_dist_divBy_c;  /* inverse of the distance between the midpoints of adjacent elements divided by heat capacity */
+  Real dt_half=dt/2;
+  int j,s;
+
+  for(s=0;s<HEATBATCH;s++)
+    lam_divBy_h[0][s]=lam[0][s]/h[0][s];
+
+  /* --- arrange all rows except last --- */
+  for(j=0;j<NHEATGRIDP-1;j++)
+    for(s=0;s<HEATBATCH;s++)
+    {
+      lam_divBy_h[j+1][s]=lam[j+1][s]/h[j+1][s];
+      inv_element_midpoint_dist_divBy_c=2/(h[j][s]+h[j+1][s])/hcap[j][s];
+      a[j][s]=-lam_divBy_h[j][s]*inv_element_midpoint_dist_divBy_c*dt_half;
+      c[j][s]=-lam_divBy_h[j+1][s]*inv_element_midpoint_dist_divBy_c*dt_half;
+      b[j][s]=1-a[j][s]-c[j][s];
+    }
+
+  /* --- arrange last row --- */
+  for(s=0;s<HEATBATCH;s++)
+  {
+    inv_element_midpoint_dist_divBy_c=(2/h[NHEATGRIDP-1][s])/hcap[NHEATGRIDP-1][s];
+    a[NHEATGRIDP-1][s]=-lam_divBy_h[NHEATGRIDP-1][s]*inv_element_midpoint_dist_divBy_c*dt_half;
+    b[NHEATGRIDP-1][s]=1-a[NHEATGRIDP-1][s];
+    c[NHEATGRIDP-1][s]=0;
+  }
+} /* of 'arrange_matrix_batch' */
@@ -65,15 +65,17 @@ void copysoil(Soil *dst,       /**< destination */
   dst->litter.agtop_cover=src->litter.agtop_cover;
   dst->litter.agtop_temp=src->litter.agtop_temp;
   dst->count=src->count;
-  freelitter(&dst->litter);
-  dst->litter.n=src->litter.n;
-  if(src->litter.n>0)
+  if(dst->litter.size<src->litter.n)
   {
+    /* litter array of destination is only reallocated if too small */
+    freelitter(&dst->litter);
     dst->litter.item=newvec(Litteritem,src->litter.n);
     check(dst->litter.item);
-    for(i=0;i<src->litter.n;i++)
-      dst->litter.item[i]=src->litter.item[i];
+    dst->litter.size=src->litter.n;
   }
+  dst->litter.n=src->litter.n;
+  for(i=0;i<src->litter.n;i++)
+    dst->litter.item[i]=src->litter.item[i];
   for(i=0;i<NFUELCLASS+1;i++)
     dst->litter.avg_fbd[i]=src->litter.avg_fbd[i];
   for(i=0;i<NSOILLAYER;i++)
@@ -77,7 +77,7 @@ Stocks daily_littersom(Stand *stand,                      /**< [inout] pointer t
   hetres.nitrogen=hetres.carbon=0;
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(DAILY_LITTERSOM_FCN,tstart);
 #endif
   soil->count++;
   *rice_em=*MT_lwater=*lrunoff=0;
@@ -149,7 +149,8 @@ Stocks daily_littersom(Stand *stand,                      /**< [inout] pointer t
 
     savesoil.decomp_litter_pft=newvec(Stocks,npft+ncft);
     check(savesoil.decomp_litter_pft);
-    savesoil.litter.n=0;
+    savesoil.litter.n=savesoil.litter.size=0;
+    savesoil.litter.item=NULL;
 
     for(dt=0;dt<timesteps;dt++)
     {
@@ -39,6 +39,7 @@ Bool freadlitter(Bstruct file, /**< File pointer to restrart file */
     return TRUE;
   if(bstruct_readbeginarray(file,name,&litter->n))
     return TRUE;
+  litter->size=litter->n;
   if(litter->n)
   {
     litter->item=newvec(Litteritem,litter->n);
@@ -54,7 +55,7 @@ Bool freadlitter(Bstruct file, /**< File pointer to restrart file */
       if(bstruct_readint(file,"pft_id",&pft_id))
       {
         free(litter->item);
-        litter->n=0;
+        litter->n=litter->size=0;
         litter->item=NULL;
         return TRUE;
       }
@@ -64,7 +65,7 @@ Bool freadlitter(Bstruct file, /**< File pointer to restrart file */
         fprintf(stderr,"ERROR195: Invalid value %d for PFT index litter, must be in [0,%d].\n",
                 pft_id,ntotpft-1);
         free(litter->item);
-        litter->n=0;
+        litter->n=litter->size=0;
         litter->item=NULL;
         return TRUE;
       }
@@ -19,8 +19,7 @@
 void freelitter(Litter *litter /**< pointer to litter data */
                )
 {
-  if(litter->n)
-    free(litter->item);
-  litter->n=0;
+  free(litter->item);
+  litter->n=litter->size=0;
   litter->item=NULL;
 } /* of 'freelitter' */
@@ -45,7 +45,7 @@ void gasdiffusion(Soil *soil,     /**< [inout] pointer to soil data */
   Real end, start, out,in;
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(GASDIFFUSION_FCN,tstart);
  #endif
 
   end=start=tmp_water=out=in=0;
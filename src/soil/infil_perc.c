@@ -94,6 +94,10 @@ Real infil_perc(Stand *stand,        /**< Stand pointer */
   Real qcharge_tot2=0;
   Real vol_water_enth=0; /* volumetric enthalpy of inflowing or outflowing water J/m^3 */
   int infil_loop_count=1;
+#ifdef USE_TIMING
+  double tstart;
+  timing_start(INFIL_PERC_FCN,tstart);
+#endif
   soil=&stand->soil;
 
 #ifdef CHECK_BALANCE
@@ -1204,7 +1208,12 @@ Real infil_perc(Stand *stand,        /**< Stand pointer */
     if(runoff+runoff_neg+runoff_surface+rsub_top>0)
       stand->cell->lateral_water+=(runoff_surface+runoff+runoff_neg+rsub_top)*stand->frac;                         // HERE RUNOFF FROM UPLAND IS COLLECTED FOR LOWLAND INPUT (src/lpj/update_daily.c)
     else
+    {
+#ifdef USE_TIMING
+      timing_stop(INFIL_PERC_FCN,tstart);
+#endif
       return runoff_surface+runoff+runoff_neg+rsub_top;
+    }
 
 
 #ifdef DEBUG
@@ -1217,7 +1226,9 @@ Real infil_perc(Stand *stand,        /**< Stand pointer */
           sprintcoord(line,&stand->cell->coord),l,soil->w[l],soil->w_fw[l],stand->type->name,soil->par->name, stand->cell->lateral_water,soil->iswetland);
     }
 #endif
-
+#ifdef USE_TIMING
+    timing_stop(INFIL_PERC_FCN,tstart);
+#endif
     return 0;
   }
   else
@@ -1231,6 +1242,8 @@ Real infil_perc(Stand *stand,        /**< Stand pointer */
           sprintcoord(line,&stand->cell->coord),l,soil->w[l],soil->w_fw[l],stand->type->name,soil->par->name, stand->cell->lateral_water);
     }
 #endif
-
+#ifdef USE_TIMING
+    timing_stop(INFIL_PERC_FCN,tstart);
+#endif
     return runoff_surface+runoff+runoff_neg+rsub_top;
 } /* of 'infil_perc' */
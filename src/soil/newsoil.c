@@ -17,7 +17,7 @@
 void newsoil(Soil *soil /**< pointer to soil data */)
 {
   int l;
-  soil->litter.n=0;
+  soil->litter.n=soil->litter.size=0;
   soil->litter.item=NULL;
   soil->litter.agtop_wcap=soil->litter.agtop_moist=soil->litter.agtop_cover=soil->litter.agtop_temp=0;
   forrootsoillayer(l)
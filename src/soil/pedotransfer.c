@@ -46,7 +46,7 @@ void pedotransfer(Stand *stand,  /**< pointer to stand */
 #endif
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(PEDOTRANSFER_FCN,tstart);
 #endif
   soil=&stand->soil;
   soilpar = soil->par;
@@ -48,13 +48,15 @@ void soil_status(Soil *dst,       /**< destination */
   dst->fastfrac=src->fastfrac;
   dst->YEDOMA=src->YEDOMA;
   dst->count=src->count;
-  freelitter(&dst->litter);
-  dst->litter.n=src->litter.n;
-  if(src->litter.n>0)
+  if(dst->litter.size<src->litter.n)
   {
+    /* litter array of destination is only reallocated if too small */
+    freelitter(&dst->litter);
     dst->litter.item=newvec(Litteritem,src->litter.n);
     check(dst->litter.item);
-    for(i=0;i<src->litter.n;i++)
-      dst->litter.item[i]=src->litter.item[i];
+    dst->litter.size=src->litter.n;
   }
+  dst->litter.n=src->litter.n;
+  for(i=0;i<src->litter.n;i++)
+    dst->litter.item[i]=src->litter.item[i];
 }
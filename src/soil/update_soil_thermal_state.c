@@ -20,7 +20,7 @@ STATIC void setup_heatgrid(Real *);
 STATIC void get_unaccounted_changes_in_water_and_solids(Real *, Real *, const Real *, const Soil *);
 STATIC void update_wi_and_sol_enth_adjusted(const Real *, const Real *, Soil *);
 STATIC void modify_enth_due_to_masschanges(Soil *, const Real *);
-STATIC void modify_enth_due_to_heatconduction(Uniform_temp_sign, Soil *, Real, Soil_thermal_prop *);
+STATIC void setup_grid_for_heatconduction(Uniform_temp_sign, const Soil *, Real *, Soil_thermal_prop *);
 STATIC void compute_litter_and_snow_temp_from_enth(Soil *, Real, const Soil_thermal_prop *);
 STATIC void compute_water_ice_ratios_from_enth(Soil *, const Soil_thermal_prop *);
 STATIC void compute_maxthaw_depth(Soil *);
@@ -38,6 +38,35 @@ void update_soil_thermal_state(Soil *soil,           /**< pointer to soil data *
                                Real airtemp,         /**< (deg C) */
                                const Config *config  /**< LPJmL configuration */
                               )
+{
+  Uniform_temp_sign uniform_temp_sign;
+  Soil_thermal_prop therm_prop;
+  Real h[NHEATGRIDP];
+#ifdef USE_TIMING
+  double tstart;
+  timing_start(UPDATE_SOIL_THERMAL_STATE_FCN,tstart);
+#endif
+  setup_soil_heatconduction(&uniform_temp_sign, &therm_prop, h, soil, airtemp, config);
+
+  /* apply numerical heatconduction scheme with airtemp as dirichlet boundary condition */
+  apply_heatconduction_of_a_day(uniform_temp_sign, soil->enth, h, airtemp, &therm_prop);
+
+  update_soil_thermal_attributes(soil, airtemp, &therm_prop);
+#ifdef USE_TIMING
+  timing_stop(UPDATE_SOIL_THERMAL_STATE_FCN,tstart);
+#endif
+} /* of 'update_soil_thermal_state' */
+
+/* The function performs all steps of the thermal update before the heat conduction,
+ * i.e. it applies the enthalpy changes due to mass changes and provides the temperature
+ * sign, the thermal properties and the grid for apply_heatconduction_of_a_day() */
+void setup_soil_heatconduction(Uniform_temp_sign *uniform_temp_sign, /**< on return: flag to indicate if the temperatures all have the same signs */
+                               Soil_thermal_prop *therm_prop,        /**< on return: thermal properties of soil */
+                               Real h[],                             /**< on return: distances between adjacent gridpoints (m) */
+                               Soil *soil,                           /**< pointer to soil data */
+                               Real airtemp,                         /**< (deg C) */
+                               const Config *config                  /**< LPJmL configuration */
+                              )
 {
   /* calculate absolute water ice content of each layer and provide it for below functions */
   Real abs_waterice_cont[NSOILLAYER];
@@ -45,23 +74,31 @@ void update_soil_thermal_state(Soil *soil,           /**< pointer to soil data *
 
   /* check if phase changes are already present in soil or can possibly happen during timestep due to airtemp forcing */
   /* without the need of considering phase changes the below calculations simplify significantly */
-  Uniform_temp_sign uniform_temp_sign;
-  uniform_temp_sign = check_uniform_temp_sign_throughout_soil(soil->enth, airtemp, abs_waterice_cont);
+  *uniform_temp_sign = check_uniform_temp_sign_throughout_soil(soil->enth, airtemp, abs_waterice_cont);
 
   /* calculate soil thermal properties and provide it for below functions */
-  Soil_thermal_prop therm_prop = {}; /* initialize struct */
-  calc_soil_thermal_props(uniform_temp_sign, &therm_prop, soil, abs_waterice_cont, NULL, config->johansen, TRUE);
+  memset(therm_prop, 0, sizeof(Soil_thermal_prop)); /* initialize struct */
+  calc_soil_thermal_props(*uniform_temp_sign, therm_prop, soil, abs_waterice_cont, NULL, config->johansen, TRUE);
 
-  /* apply daily changes to soil enthalpy distribution  due to heatconvection and heatconduction */
+  /* apply daily changes to soil enthalpy distribution due to heatconvection */
   modify_enth_due_to_masschanges(soil, abs_waterice_cont);
-  modify_enth_due_to_heatconduction(uniform_temp_sign, soil, airtemp, &therm_prop);
 
-  /* compute soil thermal attributes from enthalpy distribution and thermal properties, i.e. the derived quantities */
-  compute_mean_layer_temps_from_enth(soil->temp, soil->enth, &therm_prop);
-  compute_litter_and_snow_temp_from_enth(soil, airtemp, &therm_prop);
-  compute_water_ice_ratios_from_enth(soil, &therm_prop);
+  /* setup grid and thermal properties for heatconduction */
+  setup_grid_for_heatconduction(*uniform_temp_sign, soil, h, therm_prop);
+} /* of 'setup_soil_heatconduction' */
+
+/* The function computes the soil thermal attributes from the enthalpy distribution
+ * after the heat conduction, i.e. the derived quantities */
+void update_soil_thermal_attributes(Soil *soil,                         /**< pointer to soil data */
+                                    Real airtemp,                       /**< (deg C) */
+                                    const Soil_thermal_prop *therm_prop /**< thermal properties of soil */
+                                   )
+{
+  compute_mean_layer_temps_from_enth(soil->temp, soil->enth, therm_prop);
+  compute_litter_and_snow_temp_from_enth(soil, airtemp, therm_prop);
+  compute_water_ice_ratios_from_enth(soil, therm_prop);
   compute_maxthaw_depth(soil);
-} /* of 'update_soil_thermal_state' */
+} /* of 'update_soil_thermal_attributes' */
 
 
 /******** functions used by update_soil_thermal_state ********/
@@ -118,23 +155,15 @@ STATIC void modify_enth_due_to_masschanges(Soil *soil, const Real *abs_waterice_
   update_wi_and_sol_enth_adjusted(waterdiff, soliddiff, soil);
 } /* of 'modify_enth_due_to_masschanges' */
 
-STATIC void modify_enth_due_to_heatconduction(Uniform_temp_sign uniform_temp_sign, Soil *soil, Real airtemp, Soil_thermal_prop *therm_prop)
+STATIC void setup_grid_for_heatconduction(Uniform_temp_sign uniform_temp_sign, const Soil *soil, Real *h, Soil_thermal_prop *therm_prop)
 {
-  Real h[NHEATGRIDP], top_dirichlet_BC;
-
-  /* set the dirichlet boundary condition */
-  top_dirichlet_BC = airtemp;
-
   /* setup grid */
   setup_heatgrid(h);
 
   /* modify grid and conductivity of top element if snow or litter is present */
   adjust_grid_and_therm_cond_for_snow(h, therm_prop, soil, uniform_temp_sign);
   adjust_grid_and_therm_cond_for_litter(h, therm_prop, soil, uniform_temp_sign);
-
-  /* apply numerical heatconduction scheme */
-  apply_heatconduction_of_a_day(uniform_temp_sign, soil->enth, h, top_dirichlet_BC, therm_prop);
-} /* of 'modify_enth_due_to_heatconduction' */
+} /* of 'setup_grid_for_heatconduction' */
 
 STATIC void adjust_grid_and_therm_cond_for_snow(Real h[], Soil_thermal_prop *therm_prop, const Soil *soil, Uniform_temp_sign uniform_temp_sign)
 {
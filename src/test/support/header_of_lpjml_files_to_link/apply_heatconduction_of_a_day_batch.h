@@ -0,0 +1 @@
+void apply_heatconduction_of_a_day_batch(int, int, const Uniform_temp_sign *, Real *, const Real *, const Real *, const Soil_thermal_prop_batch *);
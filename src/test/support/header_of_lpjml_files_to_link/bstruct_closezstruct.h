@@ -0,0 +1 @@
+void bstruct_closezstruct(Bstruct);
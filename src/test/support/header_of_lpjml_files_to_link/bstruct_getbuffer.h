@@ -0,0 +1 @@
+const char *bstruct_getbuffer(Bstruct,size_t *);
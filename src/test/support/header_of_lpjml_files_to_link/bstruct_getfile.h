@@ -0,0 +1 @@
+FILE *bstruct_getfile(Bstruct);
@@ -0,0 +1 @@
+Bool bstruct_loadarray(Bstruct,int,long long,long long);
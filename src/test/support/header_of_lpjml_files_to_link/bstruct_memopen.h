@@ -0,0 +1 @@
+Bstruct bstruct_memopen(Bool);
@@ -0,0 +1 @@
+Bool bstruct_read(Bstruct,void *,size_t);
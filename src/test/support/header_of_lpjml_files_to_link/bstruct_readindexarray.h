@@ -0,0 +1 @@
+Bool bstruct_readindexarray(Bstruct,long long *,int);
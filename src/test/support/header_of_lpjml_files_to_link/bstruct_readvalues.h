@@ -0,0 +1 @@
+Bool bstruct_readvalues(Bstruct,void *,size_t,size_t);
@@ -0,0 +1 @@
+Bool bstruct_seek(Bstruct,long long,int);
@@ -0,0 +1 @@
+Bool bstruct_setcompress(Bstruct,int);
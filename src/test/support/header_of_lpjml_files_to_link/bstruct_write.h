@@ -0,0 +1 @@
+Bool bstruct_write(Bstruct,const void *,size_t);
@@ -0,0 +1 @@
+Bool bstruct_writeendzstruct(Bstruct);
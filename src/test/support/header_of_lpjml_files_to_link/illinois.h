@@ -0,0 +1 @@
+Real illinois(Real (*)(Real,void *),Real,Real,Real,Real,void *,Real,Real,int,int *);
@@ -0,0 +1 @@
+void thomas_algorithm_batch(const Real *, const Real *, const Real *, const Real *, Real *, const int, const int);
@@ -24,8 +24,15 @@
 #include "bstruct_writefloat.h"
 #include "bstruct_readfloat.h"
 #include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
 #include "bstruct_readid.h"
 #include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
 
 void test_restart(void)
 {
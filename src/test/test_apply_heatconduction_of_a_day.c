@@ -12,7 +12,9 @@
 #include "unity.h" 
 /* lpjml modules under test */
 #include "apply_heatconduction_of_a_day.h"
+#include "apply_heatconduction_of_a_day_batch.h"
 #include "thomas_algorithm.h"
+#include "thomas_algorithm_batch.h"
 #include "compute_mean_layer_temps_from_enth.h"
 #include "calc_soil_thermal_props.h"
 /* lpjml modules mocked */
@@ -175,6 +177,73 @@ void test_thomas_algorithm_correctly_solves_tridiagonal_linear_system(void)
 
 }
 
+/* The batched variant has to give the same results as the scalar function
+ * for every stand, independent of the mix of temperature signs within a batch.
+ * The number of stands is chosen such that the last batch is only partly filled. */
+#define NSTAND 11
+void test_batched_heatconduction_matches_scalar_for_all_stands(void)
+{
+  const int size = NSTAND + 2;   /* leading dimension larger than number of stands */
+  Uniform_temp_sign sign[NSTAND];
+  Real enth[NHEATGRIDP * (NSTAND + 2)], h[NHEATGRIDP * (NSTAND + 2)];
+  Real lam_frozen[NHEATGRIDP * (NSTAND + 2)], lam_unfrozen[NHEATGRIDP * (NSTAND + 2)];
+  Real c_frozen[NHEATGRIDP * (NSTAND + 2)], c_unfrozen[NHEATGRIDP * (NSTAND + 2)];
+  Real latent_heat[NHEATGRIDP * (NSTAND + 2)];
+  Real temp_top[NSTAND];
+  Real enth_scalar[NSTAND][NHEATGRIDP], h_scalar[NSTAND][NHEATGRIDP];
+  Soil_thermal_prop th[NSTAND];
+  Soil_thermal_prop_batch th_batch = {lam_frozen, lam_unfrozen, c_frozen, c_unfrozen, latent_heat};
+  int s, j, k;
+
+  memset(th, 0, sizeof(th));
+  for (s = 0; s < NSTAND; ++s)
+  {
+    sign[s] = (Uniform_temp_sign)(s % 3); /* cycles through ALL_BELOW_0, MIXED_SIGN, ALL_ABOVE_0 */
+    temp_top[s] = (sign[s] == ALL_BELOW_0 ? -5.0 - s : (sign[s] == ALL_ABOVE_0 ? 5.0 + s : 1.5));
+    for (j = 0; j < NHEATGRIDP; ++j)
+    {
+      h_scalar[s][j] = 0.1 + 0.05 * sin(j + s);
+      /* as in calc_soil_thermal_props conductivities of unused phases are left at zero */
+      if (sign[s] != ALL_ABOVE_0)
+        th[s].lam_frozen[j] = 1.5 + 0.1 * s + 0.05 * j;
+      if (sign[s] != ALL_BELOW_0)
+        th[s].lam_unfrozen[j] = 1.0 + 0.1 * s - 0.05 * j;
+      th[s].c_frozen[j] = 1.8e6 + 1e4 * s;
+      th[s].c_unfrozen[j] = 2.5e6 + 1e4 * j;
+      th[s].latent_heat[j] = 1e8 * (0.2 + 0.01 * j);
+      if (sign[s] == ALL_BELOW_0)
+        enth_scalar[s][j] = -(1.0 + j) * th[s].c_frozen[j];
+      else if (sign[s] == ALL_ABOVE_0)
+        enth_scalar[s][j] = th[s].latent_heat[j] + (1.0 + j) * th[s].c_unfrozen[j];
+      else /* gridpoints alternate between frozen, thawing and unfrozen */
+        enth_scalar[s][j] = (j % 3 - 1) * th[s].c_frozen[j] + (j % 3) * 0.5 * th[s].latent_heat[j];
+
+      /* copy to batch with stand index innermost */
+      k = j * size + s;
+      enth[k] = enth_scalar[s][j];
+      h[k] = h_scalar[s][j];
+      lam_frozen[k] = th[s].lam_frozen[j];
+      lam_unfrozen[k] = th[s].lam_unfrozen[j];
+      c_frozen[k] = th[s].c_frozen[j];
+      c_unfrozen[k] = th[s].c_unfrozen[j];
+      latent_heat[k] = th[s].latent_heat[j];
+    }
+  }
+
+  /* run scalar and batched function for a few days */
+  for (int day = 0; day < 5; ++day)
+  {
+    for (s = 0; s < NSTAND; ++s)
+      apply_heatconduction_of_a_day(sign[s], enth_scalar[s], h_scalar[s], temp_top[s], &th[s]);
+    apply_heatconduction_of_a_day_batch(NSTAND, size, sign, enth, h, temp_top, &th_batch);
+  }
+
+  /* confirm that the enthalpies are the same up to rounding */
+  for (s = 0; s < NSTAND; ++s)
+    for (j = 0; j < NHEATGRIDP; ++j)
+      TEST_ASSERT_DOUBLE_WITHIN(1e-9 * fabs(enth_scalar[s][j]) + 1e-6, enth_scalar[s][j], enth[j * size + s]);
+}
+
 /* ------- helper functions ------- */
 /* helper function to print a matrix to the console */
 void print_tridiagonal_matrix(const Real *a, const Real *b, const Real *c, int N)
@@ -12,6 +12,7 @@
 #include "unity.h" 
 /* modules under test */
 #include "thomas_algorithm.h"
+#include "thomas_algorithm_batch.h"
 #include "finite_volume_diffusion.h"
 #include "support_global_variables.h"
 #include "apply_heatconduction_of_a_day.h"
@@ -259,6 +260,40 @@ void test_arrange_matrix(void)
   TEST_ASSERT_EQUAL_DOUBLE(1 + (1/0.5*1/3.0), b[2]);
 }
 
+void test_batched_implicit_diffusion_matches_single_systems(void)
+{
+  /* solve 3 independent systems of BOTTOMLAYER layers, interleaved by layer */
+  const int n = BOTTOMLAYER, nsys = 3;
+  Real h[BOTTOMLAYER];
+  Real amount[BOTTOMLAYER * 3], diff[BOTTOMLAYER * 3], porosity[BOTTOMLAYER * 3];
+  Real amount_single[3][BOTTOMLAYER], diff_single[3][BOTTOMLAYER], porosity_single[3][BOTTOMLAYER];
+  Real gas_con_air[3] = {280.0, 0.0, 1.2};
+  Real dt = day2sec(1.0);
+  int j, k;
+
+  for (j = 0; j < n; j++)
+  {
+    h[j] = 0.2 + 0.1 * j;
+    for (k = 0; k < nsys; k++)
+    {
+      amount_single[k][j] = 10.0 * (k + 1) + j;
+      diff_single[k][j] = 1e-6 * (1 + j + 2 * k);
+      porosity_single[k][j] = 0.1 + 0.05 * (j + k);
+      amount[j * nsys + k] = amount_single[k][j];
+      diff[j * nsys + k] = diff_single[k][j];
+      porosity[j * nsys + k] = porosity_single[k][j];
+    }
+  }
+
+  TEST_ASSERT_FALSE(apply_finite_volume_diffusion_impl_batch(amount, n, nsys, h, gas_con_air, diff, porosity, dt));
+  for (k = 0; k < nsys; k++)
+  {
+    apply_finite_volume_diffusion_impl(amount_single[k], n, h, gas_con_air[k], diff_single[k], porosity_single[k], dt);
+    for (j = 0; j < n; j++)
+      TEST_ASSERT_DOUBLE_WITHIN(1e-12 * fabs(amount_single[k][j]) + 1e-15, amount_single[k][j], amount[j * nsys + k]);
+  }
+}
+
  /* ------- helper functions ------- */
  /* analytical solution for temps all above or all below zero degree i.e. without
   * phase change */
@@ -33,10 +33,17 @@
 #include "bstruct_writeendarray.h"
 #include "bstruct_readendarray.h"
 #include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
 #include "bstruct_writebeginstruct.h"
 #include "bstruct_fprintnamestack.h"
 #include "bstruct_readid.h"
 #include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
 
 #define BUFFERSIZE 10
 
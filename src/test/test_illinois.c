@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "lpj.h"
+#include "unity.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+
+#include "support_fail_stub.h"
+#include "bisect.h"
+#include "illinois.h"
+
+#define EPSILON 0.001
+
+static Real fcn(Real x,void *data)
+{
+  return x*x-*((Real *)data);
+} /* of 'fcn' */
+
+typedef struct
+{
+  Real fac;
+  int n; /* number of function calls */
+} Data;
+
+/* decreasing function with the same shape as the Ci/Ca equation in water_stressed() */
+static Real fcn_lambda(Real lambda,void *ptr)
+{
+  Data *data=(Data *)ptr;
+  data->n++;
+  return data->fac*(1-lambda)-10*sqrt(lambda)/(1+lambda);
+} /* of 'fcn_lambda' */
+
+void test_illinois(void)
+{
+  Real yzero,data;
+  int it;
+  data=2;
+  yzero=illinois(fcn,0,10,1,0.5,&data,1e-5,1e-5,1000,&it);
+  TEST_ASSERT_EQUAL_FLOAT(sqrt(data),yzero);
+}
+
+void test_illinois_matches_bisect_for_all_start_values(void)
+{
+  Data data;
+  Real guess,x_bisect,x_illinois;
+  int it,n_bisect,n_illinois;
+  for(data.fac=1;data.fac<100;data.fac*=1.5)
+  {
+    data.n=0;
+    x_bisect=bisect(fcn_lambda,0.02,0.85,&data,0,EPSILON,30,&it);
+    n_bisect=data.n;
+    for(guess=0.02;guess<=0.85;guess+=0.1)
+    {
+      data.n=0;
+      x_illinois=illinois(fcn_lambda,0.02,0.85,guess,0.05,&data,0,EPSILON,30,&it);
+      n_illinois=data.n;
+      /* solution satisfies the tolerance of water_stressed() or equals the best bisection result */
+      TEST_ASSERT_TRUE(fabs(fcn_lambda(x_illinois,&data))<EPSILON || fabs(x_illinois-x_bisect)<EPSILON);
+      /* warm start needs fewer function calls if zero is bracketed */
+      if(fabs(fcn_lambda(x_illinois,&data))<EPSILON)
+        TEST_ASSERT_TRUE(n_illinois<n_bisect);
+    }
+  }
+}
+
+void test_illinois_without_zero_returns_bisect_solution(void)
+{
+  Data data;
+  Real x_bisect,x_illinois;
+  int it;
+  data.fac=1000; /* function positive in whole interval */
+  x_bisect=bisect(fcn_lambda,0.02,0.85,&data,0,EPSILON,30,&it);
+  x_illinois=illinois(fcn_lambda,0.02,0.85,0.5,0.05,&data,0,EPSILON,30,&it);
+  TEST_ASSERT_EQUAL_DOUBLE(x_bisect,x_illinois);
+}
+
+void test_illinois_start_value_at_upper_bound(void)
+{
+  Data data;
+  Real x_bisect,x_illinois,xhigh;
+  int it,n_bisect,n_illinois;
+  data.fac=10;
+  data.n=0;
+  /* upper bound just above zero as in the water-limited case of water_stressed() */
+  xhigh=bisect(fcn_lambda,0.02,0.85,&data,0,1e-6,50,&it)+0.01;
+  data.n=0;
+  x_bisect=bisect(fcn_lambda,0.02,xhigh,&data,0,EPSILON,20,&it);
+  n_bisect=data.n;
+  data.n=0;
+  x_illinois=illinois(fcn_lambda,0.02,xhigh,xhigh,0.05,&data,0,EPSILON,20,&it);
+  n_illinois=data.n;
+  TEST_ASSERT_TRUE(fabs(fcn_lambda(x_illinois,&data))<EPSILON || fabs(x_illinois-x_bisect)<EPSILON);
+  TEST_ASSERT_TRUE(n_illinois<n_bisect);
+}
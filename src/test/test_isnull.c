@@ -26,9 +26,16 @@
 #include "bstruct_readfloat.h"
 #include "bstruct_readendstruct.h"
 #include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
 #include "bstruct_fprintnamestack.h"
 #include "bstruct_readid.h"
 #include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
 #include "bstruct_writenull.h"
 #include "bstruct_isnull.h"
 
@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "lpj.h"
+#include "unity.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+
+#include "support_fail_stub.h"
+#include "list.h"
+#include "hash.h"
+#include "swap.h"
+#include "freadtopheader.h"
+#include "fwritetopheader.h"
+#include "fputprintable.h"
+#include "bstruct_intern.h"
+#include "bstruct_skipdata.h"
+#include "bstruct_findobject.h"
+#include "bstruct_wopen.h"
+#include "bstruct_open.h"
+#include "bstruct_writeint.h"
+#include "bstruct_writename.h"
+#include "bstruct_readint.h"
+#include "bstruct_writefloat.h"
+#include "bstruct_readfloat.h"
+#include "bstruct_writebeginarray.h"
+#include "bstruct_readbeginarray.h"
+#include "bstruct_writeendarray.h"
+#include "bstruct_readendarray.h"
+#include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
+#include "bstruct_fprintnamestack.h"
+#include "bstruct_readid.h"
+#include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
+#include "bstruct_writebeginindexarray.h"
+#include "bstruct_getarrayindex.h"
+#include "bstruct_readindexarray.h"
+#include "bstruct_loadarray.h"
+#include "bstruct_writearrayindex.h"
+
+#define N 10
+
+void test_loadarray(void)
+{
+  char *filename;
+  Bstruct bstr;
+  long long pos[N],filepos;
+  float vec[N],value;
+  int i,size;
+  filename=tmpnam(NULL);
+  bstr=bstruct_create(filename);
+  TEST_ASSERT_NOT_NULL(bstr);
+  bstruct_writebeginindexarray(bstr,"vec",&filepos,N);
+  for(i=0;i<N;i++)
+  {
+    vec[i]=i;
+    pos[i]=bstruct_getarrayindex(bstr);
+    bstruct_writefloat(bstr,NULL,vec[i]);
+  }
+  bstruct_writearrayindex(bstr,filepos,pos,0,N);
+  bstruct_writeendarray(bstr);
+  bstruct_finish(bstr);
+  bstr=bstruct_open(filename,TRUE);
+  TEST_ASSERT_NOT_NULL(bstr);
+  bstruct_readbeginarray(bstr,"vec",&size);
+  TEST_ASSERT_EQUAL_INT(N,size);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readindexarray(bstr,pos,N));
+  /* read items 5 to 7 into memory */
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_loadarray(bstr,5,pos[5],pos[8]));
+  for(i=5;i<8;i++)
+  {
+    TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readfloat(bstr,NULL,&value));
+    TEST_ASSERT_EQUAL_FLOAT(vec[i],value);
+  }
+  bstruct_finish(bstr);
+  unlink(filename);
+}
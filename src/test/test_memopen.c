@@ -0,0 +1,94 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "lpj.h"
+#include "unity.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+
+#include "support_fail_stub.h"
+#include "list.h"
+#include "hash.h"
+#include "swap.h"
+#include "freadtopheader.h"
+#include "fwritetopheader.h"
+#include "fputprintable.h"
+#include "bstruct_intern.h"
+#include "bstruct_skipdata.h"
+#include "bstruct_findobject.h"
+#include "bstruct_wopen.h"
+#include "bstruct_open.h"
+#include "bstruct_memopen.h"
+#include "bstruct_getbuffer.h"
+#include "bstruct_writeint.h"
+#include "bstruct_writename.h"
+#include "bstruct_readint.h"
+#include "bstruct_writefloat.h"
+#include "bstruct_readfloat.h"
+#include "bstruct_writebeginarray.h"
+#include "bstruct_readbeginarray.h"
+#include "bstruct_writeendarray.h"
+#include "bstruct_readendarray.h"
+#include "bstruct_getfile.h"
+#include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
+#include "bstruct_fprintnamestack.h"
+#include "bstruct_readid.h"
+#include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
+
+#define N 10
+
+static void writedata(Bstruct bstr,const float vec[])
+{
+  int i;
+  bstruct_writeint(bstr,"year",2000);
+  bstruct_writebeginarray(bstr,"vec",N);
+  for(i=0;i<N;i++)
+    bstruct_writefloat(bstr,NULL,vec[i]);
+  bstruct_writeendarray(bstr);
+}
+
+void test_memopen(void)
+{
+  char *filename,*data;
+  FILE *file;
+  Bstruct bstr,mem;
+  const char *buffer;
+  size_t size;
+  long long offset;
+  float vec[N];
+  int i;
+  for(i=0;i<N;i++)
+    vec[i]=i;
+  /* write same data into file and into memory */
+  filename=tmpnam(NULL);
+  bstr=bstruct_create(filename);
+  TEST_ASSERT_NOT_NULL(bstr);
+  offset=ftell(bstruct_getfile(bstr));
+  writedata(bstr,vec);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_finish(bstr));
+  mem=bstruct_memopen(TRUE);
+  TEST_ASSERT_NOT_NULL(mem);
+  writedata(mem,vec);
+  buffer=bstruct_getbuffer(mem,&size);
+  TEST_ASSERT_NOT_NULL(buffer);
+  /* data in memory must be identical to data after file header */
+  data=malloc(size);
+  TEST_ASSERT_NOT_NULL(data);
+  file=fopen(filename,"rb");
+  TEST_ASSERT_NOT_NULL(file);
+  fseek(file,offset,SEEK_SET);
+  TEST_ASSERT_EQUAL_INT(size,fread(data,1,size,file));
+  fclose(file);
+  TEST_ASSERT_EQUAL_MEMORY(data,buffer,size);
+  free(data);
+  bstruct_finish(mem);
+  unlink(filename);
+}
@@ -0,0 +1,87 @@
+/* ------- c libraries ------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ------- headers with no corresponding .c files ------- */
+#include "lpj.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+#include "unity.h"
+/* modules under test */
+#include "mempool.h"
+#include "list.h"
+#include "support_fail_stub.h"
+
+#define N 100
+
+typedef struct
+{
+  char c;
+  double x;
+} Item;
+
+/* ------- tests ------- */
+void test_mempool_should_reuse_released_objects()
+{
+  Mempool pool;
+  Item *item[N],*last;
+  int i,j;
+  TEST_ASSERT_FALSE(initmempool(&pool,sizeof(Item),4,1));
+  for(i=0;i<N;i++)
+  {
+    item[i]=getmempoolitem(&pool);
+    TEST_ASSERT_NOT_NULL(item[i]);
+    /* objects must be aligned for double and must not overlap */
+    TEST_ASSERT_EQUAL_INT(0,(size_t)item[i] % sizeof(double));
+    item[i]->c=(char)i;
+    item[i]->x=i;
+  }
+  for(i=0;i<N;i++)
+  {
+    TEST_ASSERT_EQUAL_INT((char)i,item[i]->c);
+    TEST_ASSERT_EQUAL_DOUBLE(i,item[i]->x);
+    for(j=0;j<i;j++)
+      TEST_ASSERT_TRUE(item[i]!=item[j]);
+  }
+  /* last released object is returned first */
+  last=item[N/2];
+  putmempoolitem(&pool,item[N/2]);
+  TEST_ASSERT_EQUAL_PTR(last,getmempoolitem(&pool));
+  freemempool(&pool);
+  TEST_ASSERT_NULL(pool.list);
+}
+
+void test_mempool_not_initialized_should_use_malloc()
+{
+  Mempool pool={sizeof(Item),4,0,NULL};
+  Item *item;
+  item=getmempoolitem(&pool);
+  TEST_ASSERT_NOT_NULL(item);
+  item->x=1;
+  putmempoolitem(&pool,item);
+  freemempool(&pool);
+}
+
+void test_list_should_grow_by_doubling()
+{
+  List *list;
+  int i,data[N];
+  list=newlist(0);
+  TEST_ASSERT_NOT_NULL(list);
+  for(i=0;i<N;i++)
+  {
+    data[i]=i;
+    TEST_ASSERT_EQUAL_INT(i+1,addlistitem(list,data+i));
+  }
+  TEST_ASSERT_EQUAL_INT(128,list->size);
+  /* deleted items are replaced by last item, array is not shrunk */
+  TEST_ASSERT_EQUAL_INT(N-1,dellistitem(list,0));
+  TEST_ASSERT_EQUAL_PTR(data+N-1,getlistitem(list,0));
+  TEST_ASSERT_EQUAL_INT(128,list->size);
+  while(!isempty(list))
+    dellistitem(list,0);
+  TEST_ASSERT_EQUAL_INT(1,addlistitem(list,data));
+  freelist(list);
+}
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "lpj.h"
+#include "unity.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+
+#include "support_fail_stub.h"
+#include "list.h"
+#include "hash.h"
+#include "swap.h"
+#include "freadtopheader.h"
+#include "fwritetopheader.h"
+#include "fputprintable.h"
+#include "bstruct_intern.h"
+#include "bstruct_skipdata.h"
+#include "bstruct_findobject.h"
+#include "bstruct_wopen.h"
+#include "bstruct_open.h"
+#include "bstruct_mmap.h"
+#include "bstruct_writeint.h"
+#include "bstruct_writename.h"
+#include "bstruct_readint.h"
+#include "bstruct_writefloat.h"
+#include "bstruct_readfloat.h"
+#include "bstruct_writebeginstruct.h"
+#include "bstruct_readbeginstruct.h"
+#include "bstruct_writeendstruct.h"
+#include "bstruct_readendstruct.h"
+#include "bstruct_readendarray.h"
+#include "bstruct_writebeginarray.h"
+#include "bstruct_readbeginarray.h"
+#include "bstruct_writeendarray.h"
+#include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
+#include "bstruct_fprintnamestack.h"
+#include "bstruct_readid.h"
+#include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
+#include "bstruct_writebeginindexarray.h"
+#include "bstruct_getarrayindex.h"
+#include "bstruct_readindexarray.h"
+#include "bstruct_seekindexarray.h"
+#include "bstruct_loadarray.h"
+#include "bstruct_writearrayindex.h"
+#include "bstruct_setcompress.h"
+#include "bstruct_writebeginzstruct.h"
+#include "bstruct_writeendzstruct.h"
+
+#define N 10
+
+static char *writefile(Bool iscompress)
+{
+  char *filename;
+  Bstruct bstr;
+  long long pos[N],filepos;
+  int i,j;
+  filename=tmpnam(NULL);
+  bstr=bstruct_create(filename);
+  TEST_ASSERT_NOT_NULL(bstr);
+  if(iscompress)
+  {
+#ifdef USE_ZLIB
+    TEST_ASSERT_EQUAL_INT(FALSE,bstruct_setcompress(bstr,6));
+#else
+    /* without zlib structs are written uncompressed */
+    TEST_ASSERT_EQUAL_INT(TRUE,bstruct_setcompress(bstr,6));
+#endif
+  }
+  bstruct_writebeginindexarray(bstr,"cells",&filepos,N);
+  for(i=0;i<N;i++)
+  {
+    pos[i]=bstruct_getarrayindex(bstr);
+    if(iscompress)
+      bstruct_writebeginzstruct(bstr);
+    else
+      bstruct_writebeginstruct(bstr,NULL);
+    bstruct_writeint(bstr,"i",i);
+    bstruct_writefloat(bstr,"x",i*0.5);
+    /* array with many equal values can be compressed */
+    bstruct_writebeginarray(bstr,"y",100);
+    for(j=0;j<100;j++)
+      bstruct_writefloat(bstr,NULL,i*2.0);
+    bstruct_writeendarray(bstr);
+    if(iscompress)
+      bstruct_writeendzstruct(bstr);
+    else
+      bstruct_writeendstruct(bstr);
+  }
+  bstruct_writearrayindex(bstr,filepos,pos,0,N);
+  bstruct_writeendarray(bstr);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_finish(bstr));
+  return filename;
+}
+
+static void readcell(Bstruct bstr,int i)
+{
+  float x,y;
+  int j,value,size;
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readbeginstruct(bstr,NULL));
+  /* read objects not in the order of file */
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readbeginarray(bstr,"y",&size));
+  TEST_ASSERT_EQUAL_INT(100,size);
+  for(j=0;j<size;j++)
+  {
+    TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readfloat(bstr,NULL,&y));
+    TEST_ASSERT_EQUAL_FLOAT(i*2.0,y);
+  }
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readendarray(bstr,"y"));
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readint(bstr,"i",&value));
+  TEST_ASSERT_EQUAL_INT(i,value);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readfloat(bstr,"x",&x));
+  TEST_ASSERT_EQUAL_FLOAT(i*0.5,x);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readendstruct(bstr,NULL));
+}
+
+static void readseek(Bool iscompress,Bool ismmap)
+{
+  char *filename;
+  Bstruct bstr;
+  int i,size;
+  filename=writefile(iscompress);
+  bstr=bstruct_open(filename,TRUE);
+  TEST_ASSERT_NOT_NULL(bstr);
+  if(ismmap)
+    TEST_ASSERT_EQUAL_INT(FALSE,bstruct_mmap(bstr));
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readbeginarray(bstr,"cells",&size));
+  TEST_ASSERT_EQUAL_INT(N,size);
+  /* seek to cell 3 */
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_seekindexarray(bstr,3,N));
+  for(i=3;i<N;i++)
+    readcell(bstr,i);
+  /* reading beyond end of array must fail */
+  TEST_ASSERT_EQUAL_INT(TRUE,bstruct_readbeginstruct(bstr,NULL));
+  bstruct_finish(bstr);
+  unlink(filename);
+}
+
+static void readloadarray(Bool iscompress)
+{
+  char *filename;
+  Bstruct bstr;
+  long long pos[N];
+  int i,size;
+  filename=writefile(iscompress);
+  bstr=bstruct_open(filename,TRUE);
+  TEST_ASSERT_NOT_NULL(bstr);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_mmap(bstr));
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readbeginarray(bstr,"cells",&size));
+  TEST_ASSERT_EQUAL_INT(N,size);
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_readindexarray(bstr,pos,N));
+  /* data of cells 2 to 4 are not copied from mapped file */
+  TEST_ASSERT_EQUAL_INT(FALSE,bstruct_loadarray(bstr,2,pos[2],pos[5]));
+  for(i=2;i<5;i++)
+    readcell(bstr,i);
+  bstruct_finish(bstr);
+  unlink(filename);
+}
+
+void test_mmap(void)
+{
+  readseek(FALSE,TRUE);
+}
+
+void test_mmap_loadarray(void)
+{
+  readloadarray(FALSE);
+}
+
+void test_compress(void)
+{
+  readseek(TRUE,FALSE);
+}
+
+void test_compress_loadarray(void)
+{
+  readloadarray(TRUE);
+}
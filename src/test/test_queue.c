@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "lpj.h"
+#include "unity.h"
+
+/* ------- headers with corresponding .c files that will be compiled/linked in by ceedling ------- */
+/* c unit testing framework */
+
+#include "support_fail_stub.h"
+#include "queue.h"
+#include "list.h"
+#include "hash.h"
+#include "swap.h"
+#include "freadtopheader.h"
+#include "fwritetopheader.h"
+#include "fputprintable.h"
+#include "bstruct_intern.h"
+#include "bstruct_skipdata.h"
+#include "bstruct_findobject.h"
+#include "bstruct_wopen.h"
+#include "bstruct_open.h"
+#include "bstruct_writeint.h"
+#include "bstruct_writename.h"
+#include "bstruct_readint.h"
+#include "bstruct_writereal.h"
+#include "bstruct_writerealarray.h"
+#include "bstruct_readreal.h"
+#include "bstruct_readbeginstruct.h"
+#include "bstruct_writeendstruct.h"
+#include "bstruct_readendstruct.h"
+#include "bstruct_writebeginarray.h"
+#include "bstruct_readbeginarray.h"
+#include "bstruct_writeendarray.h"
+#include "bstruct_readendarray.h"
+#include "bstruct_finish.h"
+#include "bstruct_write.h"
+#include "bstruct_flush.h"
+#include "bstruct_read.h"
+#include "bstruct_readvalues.h"
+#include "bstruct_seek.h"
+#include "bstruct_writebeginstruct.h"
+#include "bstruct_fprintnamestack.h"
+#include "bstruct_readid.h"
+#include "bstruct_readtoken.h"
+#include "bstruct_readzstruct.h"
+#include "bstruct_closezstruct.h"
+
+#define QUEUESIZE 7
+
+void test_queue(void)
+{
+  Queue queue;
+  Real coeff[QUEUESIZE],conv,sum;
+  int i,j;
+  queue=newqueue(QUEUESIZE);
+  TEST_ASSERT_NOT_NULL(queue);
+  for(i=0;i<QUEUESIZE;i++)
+    coeff[i]=i+1;
+  for(i=0;i<3*QUEUESIZE+2;i++)
+  {
+    putqueue(queue,i);
+    /* element j is the value put j steps ago */
+    conv=sum=0;
+    for(j=0;j<QUEUESIZE;j++)
+    {
+      TEST_ASSERT_EQUAL_FLOAT((i-j<0) ? 0 : i-j,getqueue(queue,j));
+      conv+=getqueue(queue,j)*coeff[j];
+      sum+=getqueue(queue,j);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(sum,sumqueue(queue));
+    TEST_ASSERT_EQUAL_FLOAT(conv,convqueue(queue,coeff));
+  }
+  freequeue(queue);
+}
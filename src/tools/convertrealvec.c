@@ -0,0 +1,92 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**        c  o  n  v  e  r  t  r  e  a  l  v  e  c  .  c                          \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function converts real array from memory buffer of given data              \n**/
+/**     type. Data is read directly from the buffer without copying.               \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "types.h"
+#include "swap.h"
+
+Bool convertrealvec(const void *buffer, /**< pointer to data in file format */
+                    Real data[],        /**< array of reals converted */
+                    Real intercept,     /**< intercept for rescaling data */
+                    Real slope,         /**< slope for rescaling data */
+                    size_t n,           /**< size of real array */
+                    Bool swap,          /**< byte order has to be swapped (TRUE/FALSE) */
+                    Type type           /**< type of data in buffer */
+                   )                    /** \return TRUE on error */
+{
+  const Byte *bvec;
+  short s;
+  int i;
+  float f;
+  double d;
+  Num num;
+  size_t k;
+  bvec=buffer;
+  /* buffer may not be aligned, values are therefore copied by memcpy() */
+  switch(type)
+  {
+    case LPJ_BYTE:
+      for(k=0;k<n;k++)
+        data[k]=intercept+bvec[k]*slope;
+      break;
+    case LPJ_SHORT:
+      for(k=0;k<n;k++)
+      {
+        memcpy(&s,bvec+k*sizeof(short),sizeof(short));
+        data[k]=intercept+((swap) ? swapshort(s) : s)*slope;
+      }
+      break;
+    case LPJ_INT:
+      for(k=0;k<n;k++)
+      {
+        memcpy(&i,bvec+k*sizeof(int),sizeof(int));
+        data[k]=intercept+((swap) ? swapint(i) : i)*slope;
+      }
+      break;
+    case LPJ_FLOAT:
+      for(k=0;k<n;k++)
+      {
+        if(swap)
+        {
+          memcpy(&i,bvec+k*sizeof(float),sizeof(int));
+          f=swapfloat(i);
+        }
+        else
+          memcpy(&f,bvec+k*sizeof(float),sizeof(float));
+        data[k]=intercept+f*slope;
+      }
+      break;
+    case LPJ_DOUBLE:
+      for(k=0;k<n;k++)
+      {
+        if(swap)
+        {
+          memcpy(&num,bvec+k*sizeof(double),sizeof(double));
+          d=swapdouble(num);
+        }
+        else
+          memcpy(&d,bvec+k*sizeof(double),sizeof(double));
+        data[k]=intercept+d*slope;
+      }
+      break;
+    default:
+      return TRUE;
+  } /* of switch */
+  return FALSE;
+} /* of 'convertrealvec' */
@@ -0,0 +1,115 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**           f  w  r  i  t  e  t  i  m  i  n  g  .  c                             \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function writes timing of nested regions of LPJmL in JSON format.          \n**/
+/**     Minimum, mean and maximum time over all tasks are written. Regions         \n**/
+/**     are nested as recorded by the stack of open regions. Time of regions       \n**/
+/**     nested in a region called from several regions is split in                 \n**/
+/**     proportion to the time of the region in each calling region.               \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#ifdef USE_TIMING
+
+#define N_NESTED ((N_FCN+1)*N_FCN) /* size of timing_nested array */
+
+static void fprintregion(FILE *file,           /**< pointer to JSON file */
+                         int parent,           /**< id of calling region */
+                         int id,               /**< region id */
+                         double frac,          /**< fraction of time attributed to calling region */
+                         const double t_min[], /**< minimum time (sec) */
+                         const double t_avg[], /**< mean time (sec) */
+                         const double t_max[], /**< maximum time (sec) */
+                         double total,         /**< total running time (sec) */
+                         int indent            /**< indentation of region */
+                        )
+{
+  int i;
+  Bool first;
+  fprintf(file,"%*s{\n",indent,"");
+  fprintf(file,"%*s  \"name\" : \"%s\",\n",indent,"",timing_fcn[id]);
+  fprintf(file,"%*s  \"min\" : %g,\n",indent,"",frac*t_min[parent*N_FCN+id]);
+  fprintf(file,"%*s  \"mean\" : %g,\n",indent,"",frac*t_avg[parent*N_FCN+id]);
+  fprintf(file,"%*s  \"max\" : %g,\n",indent,"",frac*t_max[parent*N_FCN+id]);
+  fprintf(file,"%*s  \"percent\" : %g,\n",indent,"",(total>0) ? frac*t_avg[parent*N_FCN+id]/total*100 : 0);
+  fprintf(file,"%*s  \"regions\" : [",indent,"");
+  /* fraction of time of region spent in calling region */
+  if(t_avg[N_NESTED+id]>0)
+    frac*=t_avg[parent*N_FCN+id]/t_avg[N_NESTED+id];
+  first=TRUE;
+  if(indent<4*TIMING_DEPTH)
+    for(i=0;i<N_FCN;i++)
+      if(t_max[id*N_FCN+i]>0)
+      {
+        fputs((first) ? "\n" : ",\n",file);
+        fprintregion(file,id,i,frac,t_min,t_avg,t_max,total,indent+4);
+        first=FALSE;
+      }
+  if(first)
+    fputs("]\n",file);
+  else
+    fprintf(file,"\n%*s  ]\n",indent,"");
+  fprintf(file,"%*s}",indent,"");
+} /* of 'fprintregion' */
+
+Bool fwritetiming(const char *filename, /**< filename of JSON file */
+                  double total,         /**< Total running time (sec) */
+                  const Config *config  /**< LPJmL configuration */
+                 )                      /** \return TRUE on error */
+{
+  FILE *file;
+  int i;
+  Bool first;
+  /* nested times followed by total time of each region */
+  double t[N_NESTED+N_FCN],t_min[N_NESTED+N_FCN],t_avg[N_NESTED+N_FCN],t_max[N_NESTED+N_FCN];
+  memcpy(t,timing_nested,sizeof(double)*N_NESTED);
+  memcpy(t+N_NESTED,timing,sizeof(double)*N_FCN);
+#ifdef USE_MPI
+  MPI_Reduce(t,t_min,N_NESTED+N_FCN,MPI_DOUBLE,MPI_MIN,0,config->comm);
+  MPI_Reduce(t,t_max,N_NESTED+N_FCN,MPI_DOUBLE,MPI_MAX,0,config->comm);
+  MPI_Reduce(t,t_avg,N_NESTED+N_FCN,MPI_DOUBLE,MPI_SUM,0,config->comm);
+  for(i=0;i<N_NESTED+N_FCN;i++)
+    t_avg[i]/=config->ntask;
+#else
+  for(i=0;i<N_NESTED+N_FCN;i++)
+    t_min[i]=t_avg[i]=t_max[i]=t[i];
+#endif
+  if(!isroot(*config))
+    return FALSE;
+  file=fopen(filename,"w");
+  if(file==NULL)
+  {
+    printfcreateerr(filename);
+    return TRUE;
+  }
+  fprintf(file,"{\n"
+               "  \"total\" : %g,\n"
+               "  \"ntask\" : %d,\n"
+               "  \"regions\" : [\n",
+          total,config->ntask);
+  first=TRUE;
+  for(i=0;i<N_FCN;i++)
+    if(t_max[NO_PARENT*N_FCN+i]>0)
+    {
+      if(!first)
+        fputs(",\n",file);
+      fprintregion(file,NO_PARENT,i,1,t_min,t_avg,t_max,total,4);
+      first=FALSE;
+    }
+  fputs("\n  ]\n}\n",file);
+  fclose(file);
+  return FALSE;
+} /* of 'fwritetiming' */
+
+#endif /* of USE_TIMING */
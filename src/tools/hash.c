@@ -174,6 +174,36 @@ void *gethashitem(Hash hash,      /**< pointer to hash */
   return NULL;
 } /* of 'gethashitem' */
 
+Bool findhashitem(Hash hash,       /**< pointer to hash */
+                  const char *key, /**< key to find in hash */
+                  Hashitem *found  /**< [out] key and data stored in hash */
+                 )                 /** \return TRUE if key was found */
+{
+  /* Function gets object and its key stored in hash */
+  int index;
+  struct hashitem *item;
+  if(key!=NULL)
+  {
+    index=(*hash->hashfcn)(key,hash->size);
+#ifdef SAFE
+    /* index must be in [0,size-1] */
+    if(index<0 || index>=hash->size)
+    {
+      fprintf(stderr,"ERROR266: Invalid hash value %d, must be in [0,%d].\n",index,hash->size-1);
+      return FALSE;
+    }
+#endif
+    for(item=hash->array[index];item!=NULL;item=item->next)
+      if(!strcmp(key,item->key))
+      {
+        found->key=item->key;
+        found->data=item->data;
+        return TRUE;
+      }
+  }
+  return FALSE;
+} /* of 'findhashitem' */
+
 Hashitem *hash2array(const Hash hash /**< pointer to hash */
                     )                /** \return allocated array of names or NULL on error */
 {
@@ -25,7 +25,7 @@ List *newlist(int size /**< size of list */
   list=(List *)malloc(sizeof(List));
   if(list==NULL)
     return NULL;
-  list->n=size;
+  list->n=list->size=size;
   if(size==0)
     list->data=NULL;
   else
@@ -45,10 +45,15 @@ int addlistitem(List *list, /**< pointer to list */
                )            /** \return updated length of list or 0 in case of error */
 {
   void **ptr;
-  ptr=(void **)realloc(list->data,sizeof(void *)*(list->n+1));
-  if(ptr==NULL)
-    return 0;
-  list->data=ptr;
+  if(list->n==list->size)
+  {
+    /* double size of array to avoid reallocation for each item added */
+    ptr=(void **)realloc(list->data,sizeof(void *)*((list->size==0) ? 1 : 2*list->size));
+    if(ptr==NULL)
+      return 0;
+    list->data=ptr;
+    list->size=(list->size==0) ? 1 : 2*list->size;
+  }
   list->data[list->n++]=item;
   return list->n;
 } /* of 'addlistitem' */
@@ -66,13 +71,7 @@ int dellistitem(List *list, /**< pointer to list */
 #endif
   list->n--;
   list->data[index]=list->data[list->n];
-  if(isempty(list))
-  {
-    free(list->data);
-    list->data=NULL;
-  }
-  else
-    list->data=(void **)realloc(list->data,sizeof(void *)*list->n);
+  /* array is not shrunk, allocated memory is reused by addlistitem() */
   return list->n;
 } /* of 'dellistitem' */
 
@@ -80,7 +79,6 @@ void freelist(List *list /**<  pointer to list */
              )
 {
   /* functions frees memory of list */
-  if(!isempty(list))
-    free(list->data);
+  free(list->data);
   free(list);
 } /* of 'freelist' */
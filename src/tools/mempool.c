@@ -0,0 +1,113 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**                  m  e  m  p  o  o  l  .  c                                     \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Pool allocator for objects of fixed size. Objects are taken from           \n**/
+/**     chunks of memory growing by doubling the number of objects and             \n**/
+/**     released objects are kept in a free list for each thread.                  \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+typedef union
+{
+  void *ptr;
+  double d;
+  long long l;
+} Align; /* object size is a multiple of this size to keep alignment */
+
+Bool initmempool(Mempool *pool, /**< pointer to memory pool */
+                 size_t size,   /**< size of objects in bytes */
+                 int n,         /**< number of objects in first chunk */
+                 int nthreads   /**< number of threads */
+                )               /** \return TRUE on error */
+{
+  int i;
+  pool->size=(size+sizeof(Align)-1)/sizeof(Align)*sizeof(Align);
+  pool->n=n;
+  pool->nthreads=nthreads;
+  pool->list=newvec(Mempoollist,nthreads);
+  if(pool->list==NULL)
+    return TRUE;
+  for(i=0;i<nthreads;i++)
+  {
+    pool->list[i].free=pool->list[i].chunk=NULL;
+    pool->list[i].n=n;
+  }
+  return FALSE;
+} /* of 'initmempool' */
+
+void *getmempoolitem(Mempool *pool /**< pointer to memory pool */
+                    )              /** \return pointer to object or NULL */
+{
+  Mempoollist *list;
+  char *chunk;
+  void *item;
+  int i;
+  if(pool->list==NULL) /* pool not initialized, use system allocator */
+    return malloc(pool->size);
+  list=pool->list+getthreadnum();
+  if(list->free==NULL)
+  {
+    /* allocate new chunk, first slot stores pointer to previous chunk */
+    chunk=malloc(pool->size*(list->n+1));
+    if(chunk==NULL)
+      return NULL;
+    *(void **)chunk=list->chunk;
+    list->chunk=chunk;
+    for(i=list->n;i>0;i--)
+    {
+      *(void **)(chunk+pool->size*i)=list->free;
+      list->free=chunk+pool->size*i;
+    }
+    list->n*=2;
+  }
+  item=list->free;
+  list->free=*(void **)item;
+  return item;
+} /* of 'getmempoolitem' */
+
+void putmempoolitem(Mempool *pool, /**< pointer to memory pool */
+                    void *item     /**< object to be released */
+                   )
+{
+  Mempoollist *list;
+  if(item==NULL)
+    return;
+  if(pool->list==NULL)
+    free(item);
+  else
+  {
+    /* objects may have been taken from chunk of another thread */
+    list=pool->list+getthreadnum();
+    *(void **)item=list->free;
+    list->free=item;
+  }
+} /* of 'putmempoolitem' */
+
+void freemempool(Mempool *pool /**< pointer to memory pool */
+                )
+{
+  void *chunk;
+  int i;
+  if(pool->list==NULL)
+    return;
+  for(i=0;i<pool->nthreads;i++)
+    while(pool->list[i].chunk!=NULL)
+    {
+      chunk=pool->list[i].chunk;
+      pool->list[i].chunk=*(void **)chunk;
+      free(chunk);
+    }
+  free(pool->list);
+  pool->list=NULL;
+} /* of 'freemempool' */
@@ -0,0 +1,162 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**               m  e  r  g  e  h  a  s  h  .  c                                  \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function merges name hashes of all tasks into one hash with                \n**/
+/**     unique ids. Ids of names on the root task are kept                         \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#ifdef USE_MPI
+
+static int cmpid(const void *a,const void *b)
+{
+  return *((short *)((const Hashitem *)a)->data)-*((short *)((const Hashitem *)b)->data);
+} /* of 'cmpid' */
+
+static char *packhash(const Hash hash, /**< pointer to hash */
+                      Bool withid,     /**< store ids in buffer */
+                      int *size        /**< [out] size of buffer in bytes */
+                     )                 /** \return pointer to buffer */
+{
+  /* Function packs names sorted by id into buffer: |len|name|[id]|... */
+  Hashitem *items;
+  char *buffer,*ptr;
+  int i,count;
+  Byte len;
+  count=gethashcount(hash);
+  items=hash2array(hash);
+  check(items);
+  qsort(items,count,sizeof(Hashitem),cmpid);
+  *size=0;
+  for(i=0;i<count;i++)
+    *size+=1+strlen(items[i].key)+((withid) ? sizeof(short) : 0);
+  buffer=malloc(max(*size,1));
+  check(buffer);
+  ptr=buffer;
+  for(i=0;i<count;i++)
+  {
+    len=strlen(items[i].key);
+    *ptr++=len;
+    memcpy(ptr,items[i].key,len);
+    ptr+=len;
+    if(withid)
+    {
+      memcpy(ptr,items[i].data,sizeof(short));
+      ptr+=sizeof(short);
+    }
+  }
+  free(items);
+  return buffer;
+} /* of 'packhash' */
+
+static void addname(Hash hash,        /**< pointer to hash */
+                    const char *name, /**< name to add */
+                    int len,          /**< length of name */
+                    short value       /**< id of name */
+                   )
+{
+  char *key;
+  short *id;
+  key=malloc(len+1);
+  check(key);
+  memcpy(key,name,len);
+  key[len]='\0';
+  id=new(short);
+  check(id);
+  *id=value;
+  if(addhashitem(hash,key,id)==0)
+    fail(ALLOC_MEMORY_ERR,TRUE,FALSE,"Cannot allocate memory for hash in mergehash()");
+} /* of 'addname' */
+
+void mergehash(Hash global,      /**< hash filled with names of all tasks, must be empty */
+               const Hash local, /**< hash of names used by task */
+               MPI_Comm comm     /**< MPI communicator */
+              )
+{
+  char *buffer,*all,*ptr,key[UCHAR_MAX+1];
+  int *counts,*offsets;
+  int i,size,rank,ntask;
+  short id;
+  Byte len;
+  MPI_Comm_rank(comm,&rank);
+  MPI_Comm_size(comm,&ntask);
+  /* gather names of all tasks on root task */
+  buffer=packhash(local,FALSE,&size);
+  counts=offsets=NULL;
+  all=NULL;
+  if(rank==0)
+  {
+    counts=newvec(int,ntask);
+    check(counts);
+    offsets=newvec(int,ntask);
+    check(offsets);
+  }
+  MPI_Gather(&size,1,MPI_INT,counts,1,MPI_INT,0,comm);
+  if(rank==0)
+  {
+    offsets[0]=0;
+    for(i=1;i<ntask;i++)
+      offsets[i]=offsets[i-1]+counts[i-1];
+    all=malloc(max(offsets[ntask-1]+counts[ntask-1],1));
+    check(all);
+  }
+  MPI_Gatherv(buffer,size,MPI_BYTE,all,counts,offsets,MPI_BYTE,0,comm);
+  free(buffer);
+  if(rank==0)
+  {
+    /* names of root task keep their ids, new names of other tasks are appended in order of tasks */
+    ptr=all;
+    while(ptr<all+offsets[ntask-1]+counts[ntask-1])
+    {
+      len=*ptr++;
+      memcpy(key,ptr,len);
+      key[len]='\0';
+      if(gethashitem(global,key)==NULL)
+      {
+        if(ptr-1<all+counts[0])
+          id=*((short *)gethashitem(local,key));
+        else
+          id=gethashcount(global);
+        addname(global,key,len,id);
+      }
+      ptr+=len;
+    }
+    free(all);
+    free(counts);
+    free(offsets);
+    buffer=packhash(global,TRUE,&size);
+  }
+  /* broadcast merged names and ids to all tasks */
+  MPI_Bcast(&size,1,MPI_INT,0,comm);
+  if(rank)
+  {
+    buffer=malloc(max(size,1));
+    check(buffer);
+  }
+  MPI_Bcast(buffer,size,MPI_BYTE,0,comm);
+  if(rank)
+  {
+    ptr=buffer;
+    while(ptr<buffer+size)
+    {
+      len=*ptr++;
+      memcpy(&id,ptr+len,sizeof(short));
+      addname(global,ptr,len,id);
+      ptr+=len+sizeof(short);
+    }
+  }
+  free(buffer);
+} /* of 'mergehash' */
+
+#endif
@@ -53,7 +53,7 @@ Bool mpi_write(FILE *file,        /**< File pointer to binary file */
   MPI_Bcast(&rc,1,MPI_INT,0,comm);
 #ifdef USE_TIMING
   double tstart;
-  timing_start(tstart);
+  timing_start(MPI_BARRIER_FCN,tstart);
 #endif
   MPI_Barrier(comm);
 #ifdef USE_TIMING
@@ -0,0 +1,50 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**        m  p  i  _  w  r  i  t  e  _  f  i  l  e  .  c                          \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function writes output data into file. If parallel write is                \n**/
+/**     enabled each task writes its slice directly at its offset                  \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#ifdef USE_MPI
+
+Bool mpi_write_file(File *file,        /**< pointer to output file */
+                    void *data,        /**< data to be written to disk */
+                    MPI_Datatype type, /**< MPI datatype of data */
+                    int size,          /**< total number of items */
+                    int counts[],      /**< number of items for each task */
+                    int offsets[],     /**< offsets for each task */
+                    int rank,          /**< MPI rank */
+                    MPI_Comm comm      /**< MPI communicator */
+                   )                   /** \return TRUE on error */
+{
+  MPI_Aint lb,extent;
+  char errmsg[MPI_MAX_ERROR_STRING];
+  int rc,len;
+  if(!file->isparallel)
+    return mpi_write(file->fp.file,data,type,size,counts,offsets,rank,comm);
+  MPI_Type_get_extent(type,&lb,&extent);
+  /* each task writes its own slice, no gather on root and no barrier needed */
+  rc=MPI_File_write_at_all(file->fh,file->pos+(MPI_Offset)offsets[rank]*extent,
+                           data,counts[rank],type,MPI_STATUS_IGNORE);
+  file->pos+=(MPI_Offset)size*extent;
+  if(rc!=MPI_SUCCESS)
+  {
+    MPI_Error_string(rc,errmsg,&len);
+    fprintf(stderr,"ERROR204: Cannot write output: %s.\n",errmsg);
+    return TRUE;
+  }
+  return FALSE;
+} /* of 'mpi_write_file' */
+#endif
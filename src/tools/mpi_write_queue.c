@@ -0,0 +1,62 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**      m  p  i  _  w  r  i  t  e  _  q  u  e  u  e  .  c                         \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Function gathers unscaled output data on root task and appends them        \n**/
+/**     to the asynchronous write queue. Only the calling thread performs          \n**/
+/**     MPI calls, scaling and writing is done by the writer thread. Errors        \n**/
+/**     of the writer are only returned on the root task.                          \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#ifdef USE_MPI
+
+Bool mpi_write_queue(Writequeue queue,  /**< asynchronous write queue of root task */
+                     int fmt,           /**< file format (RAW/CLM/TXT/CDF) */
+                     FILE *file,        /**< File pointer to output file or NULL */
+                     Netcdf *cdf,       /**< pointer to NetCDF file or NULL */
+                     void *data,        /**< unscaled data to be written to disk */
+                     MPI_Datatype type, /**< MPI datatype of data (MPI_FLOAT/MPI_SHORT) */
+                     int size,          /**< total number of items */
+                     Real scale,        /**< scaling factor */
+                     Real offset,       /**< offset added after scaling */
+                     int index,         /**< time index for NetCDF files */
+                     int layer,         /**< layer for NetCDF files or -1 */
+                     int counts[],      /**< number of items for each task */
+                     int offsets[],     /**< offsets for each task */
+                     int rank,          /**< MPI rank */
+                     char delimit,      /**< delimiter for text files */
+                     MPI_Comm comm      /**< MPI communicator */
+                    )                   /** \return TRUE on error on root task */
+{
+  Bool rc=FALSE;
+  MPI_Aint lb;
+  MPI_Aint extent;
+  void *vec=NULL;
+  MPI_Type_get_extent(type,&lb,&extent);
+  if(rank==0)
+  {
+    vec=malloc(size*extent); /* allocate receive buffer */
+    check(vec);
+  }
+  MPI_Gatherv(data,counts[rank],type,vec,counts,offsets,type,0,comm);
+  if(rank==0)
+  {
+    /* data are copied into queue, root task continues before data are on disk */
+    rc=putwritequeue(queue,fmt,file,cdf,(type==MPI_SHORT) ? LPJ_SHORT : LPJ_FLOAT,
+                     vec,size,scale,offset,index,layer,delimit);
+    free(vec);
+  }
+  return rc;
+} /* of 'mpi_write_queue' */
+#endif
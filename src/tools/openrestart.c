@@ -5,7 +5,8 @@
 /**     C implementation of LPJmL                                                  \n**/
 /**                                                                                \n**/
 /**     Function opens restart file and seeks to first grid cell as                \n**/
-/**     specified in LPJ configuration                                             \n**/
+/**     specified in LPJ configuration. Optionally the data of all cells of        \n**/
+/**     the task are read in one block into memory.                                \n**/
 /**                                                                                \n**/
 /** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
 /** authors, and contributors see AUTHORS file                                     \n**/
@@ -21,8 +22,7 @@ if(bstruct_readint(file,name,var))\
   {\
     if(isroot(*config))\
       fprintf(stderr,"ERROR245: Cannot read header in %s file '%s'.\n",type,filename);\
-    bstruct_finish(file);\
-    return NULL; \
+    return TRUE; \
   }
 
 #define readbool(file,name,var) \
@@ -30,43 +30,88 @@ if(bstruct_readbool(file,name,var))\
   {\
     if(isroot(*config))\
       fprintf(stderr,"ERROR245: Cannot read header in %s file '%s'.\n",type,filename);\
-    bstruct_finish(file);\
-    return NULL; \
+    return TRUE; \
   }
 
-Bstruct openrestart(const char *filename, /**< filename of restart file */
-                    Config *config,       /**< LPJ configuration */
-                    int npft,             /**< number of natural PFTs */
-                    int ncft              /**< number of crop PFTs */
-                   )                      /** \return pointer to restart file or NULL */
+static Bool getblock(Bstruct file,          /**< pointer to restart file */
+                     long long pos[2],      /**< [out] file positions of data block of task */
+                     int ncell,             /**< number of cells in restart file */
+                     int firstcell,         /**< index of first cell in restart file */
+                     const char *filename,  /**< filename of restart file */
+                     const Config *config   /**< LPJ configuration */
+                    )                       /** \return TRUE on error */
+{
+  /* Function reads index vector on root task and sends start and end
+     position of data of each task */
+  long long *index,*vec;
+  int i,offset;
+  Bool rc;
+  rc=FALSE;
+  vec=NULL;
+  if(isroot(*config))
+  {
+    index=newvec(long long,ncell);
+    check(index);
+    vec=newvec(long long,2*config->ntask);
+    check(vec);
+    if(bstruct_readindexarray(file,index,ncell))
+    {
+      fprintf(stderr,"ERROR156: Cannot read index vector in restart file '%s'.\n",filename);
+      rc=TRUE;
+    }
+    else
+    {
+      offset=config->firstgrid-firstcell;
+      for(i=0;i<config->ntask;i++)
+      {
+        vec[2*i]=index[offset];
+        offset+=config->cellcounts[i];
+        /* block of last task ends at start of name table */
+        vec[2*i+1]=(offset<ncell) ? index[offset] : bstruct_getnamepos(file);
+      }
+    }
+    free(index);
+  }
+#ifdef USE_MPI
+  MPI_Bcast(&rc,1,MPI_INT,0,config->comm);
+  if(!rc)
+    MPI_Scatter(vec,2,MPI_LONG_LONG,pos,2,MPI_LONG_LONG,0,config->comm);
+#else
+  if(!rc)
+  {
+    pos[0]=vec[0];
+    pos[1]=vec[1];
+  }
+#endif
+  free(vec);
+  return rc;
+} /* of 'getblock' */
+
+static Bool readheader(Bstruct file,          /**< pointer to restart file */
+                       int *firstcell,        /**< [out] index of first cell in restart file */
+                       int *ncell,            /**< [out] number of cells in restart file */
+                       int npft,              /**< number of natural PFTs */
+                       int ncft,              /**< number of crop PFTs */
+                       const char *type,      /**< "restart" or "checkpoint" */
+                       const char *filename,  /**< filename of restart file */
+                       Config *config         /**< LPJ configuration */
+                      )                       /** \return TRUE on error */
 {
-  Bstruct file;
   char *lpjversion,*pftname;
   Real cellsize_lon,cellsize_lat;
-  int i,offset,ncell,restart_npft,restart_ncft,firstcell,firstyear,size;
+  int i,restart_npft,restart_ncft,firstyear,size;
   Bool separate_harvests;
   Type datatype;
-  char *type;
-  /* Open restart file */
-  file=bstruct_open(filename,isroot(*config));
-  if(file==NULL)
-    return NULL;
-  bstruct_printnoread(file,config->print_noread);
-  type=(config->ischeckpoint) ? "checkpoint" : "restart";
   /* read header */
   if(bstruct_readbeginstruct(file,"header"))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR245: No header found in %s file '%s'.\n",type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   lpjversion=bstruct_readstring(file,"version");
   if(lpjversion==NULL)
-  {
-    bstruct_finish(file);
-    return NULL;
-  }
+    return TRUE;
   if(isroot(*config) && strcmp(lpjversion,getversion()))
   {
     fprintf(stderr,"WARNING041: LPJmL version %s of %s file '%s' is not %s.\n",
@@ -74,22 +119,20 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
   }
   free(lpjversion);
   readint(file,"year",&firstyear);
-  readint(file,"firstcell",&firstcell);
+  readint(file,"firstcell",firstcell);
   readint(file,"npft",&restart_npft);
   readint(file,"ncft",&restart_ncft);
   if(bstruct_readreal(file,"cellsize_lat",&cellsize_lat))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR245: Cannot read header in %s file '%s'.\n",type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(bstruct_readreal(file,"cellsize_lon",&cellsize_lon))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR245: Cannot read header in %s file '%s'.\n",type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   readint(file,"datatype",(int *)(&datatype));
   readbool(file,"landuse",&config->landuse_restart);
@@ -98,16 +141,12 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
   readbool(file,"river_routing",&config->river_routing_restart);
   readbool(file,"separate_harvests",&separate_harvests);
   if(bstruct_readbeginarray(file,"pfts",&size))
-  {
-    bstruct_finish(file);
-    return NULL;
-  }
+    return TRUE;
   if(size!=restart_npft+restart_ncft)
   {
     fprintf(stderr,"ERROR245: Size of PFT array=%d in header of '%s' is not %d.\n",
             size,filename,restart_npft+restart_ncft);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   for(i=0;i<size;i++)
   {
@@ -116,8 +155,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
     {
       fprintf(stderr,"ERROR245: Cannot read PFT name of item %d in PFT array in header of '%s'.\n",
               i+1,filename);
-      bstruct_finish(file);
-      return NULL;
+      return TRUE;
     }
     if(strcmp(pftname,config->pftpar[i].name))
     {
@@ -126,34 +164,23 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
       if(config->pedantic)
       {
         free(pftname);
-        bstruct_finish(file);
-        return NULL;
+        return TRUE;
       }
     }
     free(pftname);
   }
   if(bstruct_readendarray(file,"pfts"))
-  {
-    bstruct_finish(file);
-    return NULL;
-  }
+    return TRUE;
   if(freadseed(file,"seed",config->seed))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR245: Cannot read header in %s file '%s'.\n",type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(bstruct_readendstruct(file,"header"))
-  {
-    bstruct_finish(file);
-    return NULL;
-  }
-  if(bstruct_readbeginarray(file,"grid",&ncell))
-  {
-    bstruct_finish(file);
-    return NULL;
-  }
+    return TRUE;
+  if(bstruct_readbeginarray(file,"grid",ncell))
+    return TRUE;
   /* enable error output for all tasks */
   bstruct_setout(file,TRUE);
   if(fabs(cellsize_lon-config->resolution.lon)/config->resolution.lon>1e-3)
@@ -161,16 +188,14 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
     if(isroot(*config))
       fprintf(stderr,"ERROR154: Cell size longitude %g different from %g in %s file '%s'.\n",
               cellsize_lon,config->resolution.lon,type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(fabs(cellsize_lat-config->resolution.lat)/config->resolution.lat>1e-3)
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR154: Cell size latitude %g different from %g in %s file '%s'.\n",
               cellsize_lat,config->resolution.lat,type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(config->landuse_restart)
   {
@@ -178,16 +203,14 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
     {
       if(isroot(*config))
         fprintf(stderr,"ERROR180: Land-use setting false is different from true in %s file '%s'.\n",type,filename);
-      bstruct_finish(file);
-      return NULL;
+      return TRUE;
     }
     if(separate_harvests!=config->separate_harvests)
     {
       if(isroot(*config))
         fprintf(stderr,"ERROR180: Separate harvest setting %s is different from %s in %s file '%s'.\n",
                 bool2str(config->separate_harvests),bool2str(separate_harvests),type,filename);
-      bstruct_finish(file);
-      return NULL;
+      return TRUE;
     }
   }
   if(!config->river_routing_restart && config->river_routing)
@@ -200,8 +223,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
     if(isroot(*config))
       fprintf(stderr,"ERROR181: River-routing setting %s is different from %s in %s file '%s'.\n",
               bool2str(config->river_routing),bool2str(config->river_routing_restart),type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(isroot(*config) && config->sdate_option_restart==NO_FIXED_SDATE && config->sdate_option>NO_FIXED_SDATE && config->firstyear-config->nspinup>config->sdate_fixyear)
     fprintf(stderr,"ERROR245: Sowing dates are missing in restart file, sowing date fixed in year %d, but simulation starts in %d.\n",
@@ -211,8 +233,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR182: Real datatype does not match in %s file '%s'.\n",type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(restart_npft!=npft)
   {
@@ -221,8 +242,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
       fprintf(stderr,
               "ERROR183: Number of natural PFTs=%d does not match %d present in %s file '%s'.\n",
               npft,restart_npft,type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(restart_ncft!=ncft)
   {
@@ -231,8 +251,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
       fprintf(stderr,
               "ERROR183: Number of crop PFTs=%d does not match %d present in %s file '%s'.\n",
               ncft,restart_ncft,type,filename);
-    bstruct_finish(file);
-    return NULL;
+    return TRUE;
   }
   if(config->ischeckpoint)
   {
@@ -243,8 +262,7 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
       if(isroot(*config))
         fprintf(stderr,"ERROR233: Year %d in checkpoint file '%s' outside simulation years.\n",
                 config->checkpointyear,filename);
-      bstruct_finish(file);
-      return NULL;
+      return TRUE;
     }
   }
   else if(config->nspinup==0 && firstyear!=config->firstyear-1 &&
@@ -253,42 +271,90 @@ Bstruct openrestart(const char *filename, /**< filename of restart file */
             "WARNING005: Year of restart file=%d not equal start year=%d-1.\n",
             firstyear,config->firstyear);
 
-  if(config->firstgrid<firstcell)
+  if(config->firstgrid<(*firstcell))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR155: First grid cell %d not in %s file '%s', starts at cell %d.\n",
-              config->startgrid,type,filename,firstcell);
-    bstruct_finish(file);
-    return NULL;
+              config->startgrid,type,filename,(*firstcell));
+    return TRUE;
   }
-  if(config->firstgrid>firstcell+ncell-1)
+  if(config->firstgrid>(*firstcell)+(*ncell)-1)
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR155: First grid cell %d not in %s file '%s', starts at cell %d.\n",
-              config->startgrid,type,filename,firstcell);
-    bstruct_finish(file);
-    return NULL;
+              config->startgrid,type,filename,(*firstcell));
+    return TRUE;
   }
-  if(config->nall>ncell)
+  if(config->nall>(*ncell))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR155: %s file '%s' is too short, has only %d cells, %d needed.\n",
-              type,filename,ncell,config->nall);
-    bstruct_finish(file);
-    return NULL;
+              type,filename,(*ncell),config->nall);
+    return TRUE;
   }
-  if(config->firstgrid+config->nall>firstcell+ncell)
+  if(config->firstgrid+config->nall>(*firstcell)+(*ncell))
   {
     if(isroot(*config))
       fprintf(stderr,"ERROR155: %s file '%s' has cells in [%d,%d], must be [%d,%d].\n",
-              type,filename,firstcell,firstcell+ncell-1,
+              type,filename,(*firstcell),(*firstcell)+(*ncell)-1,
               config->firstgrid,config->firstgrid+config->nall-1);
-    bstruct_finish(file);
+    return TRUE;
+  }
+  return FALSE;
+} /* of 'readheader' */
+
+Bstruct openrestart(const char *filename, /**< filename of restart file */
+                    Config *config,       /**< LPJ configuration */
+                    int npft,             /**< number of natural PFTs */
+                    int ncft,             /**< number of crop PFTs */
+                    Bool isblock          /**< read data of all cells of task in one block (TRUE/FALSE) */
+                   )                      /** \return pointer to restart file or NULL */
+{
+  Bstruct file;
+  int offset,ncell,firstcell;
+  long long pos[2];
+  Bool rc;
+  char *type;
+  type=(config->ischeckpoint) ? "checkpoint" : "restart";
+  /* Open restart file */
+  file=bstruct_open(filename,isroot(*config));
+  if(file==NULL)
+    rc=TRUE;
+  else
+  {
+    bstruct_printnoread(file,config->print_noread);
+    if(config->mmap_restart && bstruct_mmap(file) && isroot(*config))
+      fprintf(stderr,"WARNING052: Cannot map %s file '%s' into memory: %s, file is read.\n",
+              type,filename,strerror(errno));
+    rc=readheader(file,&firstcell,&ncell,npft,ncft,type,filename,config);
+  }
+  isblock=isblock && config->cellcounts!=NULL;
+  /* getblock() is collective, all tasks have to know about errors before */
+  if((isblock) ? iserror(rc,config) : rc)
+  {
+    if(file!=NULL)
+      bstruct_finish(file);
     return NULL;
   }
   offset=config->startgrid-firstcell;
+  if(isblock)
+  {
+    /* read data of all cells of task in one block into memory */
+    if(getblock(file,pos,ncell,firstcell,filename,config))
+    {
+      bstruct_finish(file);
+      return NULL;
+    }
+    if(bstruct_loadarray(file,offset,pos[0],pos[1]))
+    {
+      fprintf(stderr,"ERROR156: Cannot read data of cells %d-%d in %s file '%s'.\n",
+              config->startgrid,config->startgrid+config->ngridcell-1,type,filename);
+      bstruct_finish(file);
+      return NULL;
+    }
+  }
   /* skip to cell */
-  if(bstruct_seekindexarray(file,offset,ncell))
+  else if(bstruct_seekindexarray(file,offset,ncell))
   {
     fprintf(stderr,"ERROR156: Cannot seek to index %d in %s file '%s'.\n",offset,type,filename);
     bstruct_finish(file);
@@ -14,6 +14,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "types.h"
 #include "hash.h"
 #include "bstruct.h"
@@ -21,13 +22,32 @@
 #include "errmsg.h"
 #include "queue.h"
 
+/*
+ * The data array is mirrored, i.e. data[i+size] is a copy of data[i]. Therefore
+ * the queue elements are always stored contiguously in data[first..first+size-1]
+ * and no modulo operation is needed when accessing the queue. The sum of all
+ * elements is updated incrementally by putqueue() and recomputed from scratch
+ * once per cycle to avoid accumulation of rounding errors.
+ */
+
 struct queue
 {
-  Real *data; /**< data array */
+  Real *data; /**< data array of length 2*size */
+  Real sum;   /**< sum of all elements in queue */
   int size;   /**< size of queue */
   int first;  /**< index of first element in queue */
 }; /* definition of opaque datatype Queue */
 
+static Real sumdata(const Real data[],int size)
+{
+  int i;
+  Real sum;
+  sum=0;
+  for(i=0;i<size;i++)
+    sum+=data[i];
+  return sum;
+} /* of 'sumdata' */
+
 Queue newqueue(int size /**< size of queue */
               )         /** \return pointer to queue or NULL on error */
 {
@@ -40,15 +60,16 @@ Queue newqueue(int size /**< size of queue */
   queue=new(struct queue);
   if(queue==NULL)
     return NULL;
-  queue->data=newvec(Real,size);
+  queue->data=newvec(Real,2*size);
   if(queue->data==NULL)
   {
     free(queue);
     return NULL;
   }
   /* initialize queue with zeros */
-  for(i=0;i<size;i++)
+  for(i=0;i<2*size;i++)
     queue->data[i]=0;
+  queue->sum=0;
   queue->size=size;
   queue->first=size-1;
   return queue;
@@ -62,7 +83,7 @@ Bool fwritequeue(Bstruct file,    /**< pointer to restart file */
   int i;
   bstruct_writebeginarray(file,name,queue->size);
   for(i=0;i<queue->size;i++)
-    if(bstruct_writereal(file,NULL,queue->data[(queue->first+i) % queue->size]))
+    if(bstruct_writereal(file,NULL,queue->data[queue->first+i]))
       return TRUE;
   return bstruct_writeendarray(file);
 } /* of 'fwritequeue' */
@@ -73,7 +94,7 @@ void fprintqueue(FILE *file,       /**< pointer to text file */
 {
   int i;
   for(i=0;i<queue->size;i++)
-    fprintf(file," %g",queue->data[(queue->first+i) % queue->size]);
+    fprintf(file," %g",queue->data[queue->first+i]);
 } /* of 'fprintqueue' */
 
 Queue freadqueue(Bstruct file,    /**< pointer to restart file */
@@ -81,18 +102,30 @@ Queue freadqueue(Bstruct file,    /**< pointer to restart file */
                 )                 /** \return pointer to queue read or NULL */
 {
   Queue queue;
+  Real *data;
   queue=new(struct queue);
   if(queue==NULL)
   {
     printallocerr("queue");
     return NULL;
   }
-  queue->data=bstruct_readvarrealarray(file,name,&queue->size);
+  data=bstruct_readvarrealarray(file,name,&queue->size);
+  if(data==NULL)
+  {
+    free(queue);
+    return NULL;
+  }
+  /* enlarge array for mirrored copy of data */
+  queue->data=realloc(data,sizeof(Real)*2*queue->size);
   if(queue->data==NULL)
   {
+    printallocerr("queue");
+    free(data);
     free(queue);
     return NULL;
   }
+  memcpy(queue->data+queue->size,queue->data,sizeof(Real)*queue->size);
+  queue->sum=sumdata(queue->data,queue->size);
   queue->first=0;
   return queue;
 } /* of 'freadqueue' */
@@ -101,7 +134,7 @@ Real getqueue(const Queue queue, /**< pointer to queue */
               int i              /**< index of requested queue element */
              )                   /** \return first element in queue */
 {
-  return queue->data[(queue->first+i) % queue->size];
+  return queue->data[queue->first+i];
 } /* of 'getqueue' */
 
 int queuesize(const Queue queue /**< pointer to queue */
@@ -115,24 +148,45 @@ void putqueue(Queue queue, /**< pointer to queue */
              )
 {
   /*
-   * move index of first element and store val there
+   * move index of first element and store val there, the last element
+   * dropped out of the queue is overwritten
    */
-  queue->first=(queue->first-1+queue->size) % queue->size;
-  queue->data[queue->first]=val;
+  queue->first=(queue->first==0) ? queue->size-1 : queue->first-1;
+  queue->sum+=val-queue->data[queue->first];
+  queue->data[queue->first]=queue->data[queue->first+queue->size]=val;
+  if(queue->first==0)
+    queue->sum=sumdata(queue->data,queue->size);
 } /* of 'putqueue' */
 
 Real sumqueue(const Queue queue /**< pointer to queue */
              )                  /** \return total sum */
 {
-  int i;
-  Real sum;
-  sum=0;
-
-  for(i=0;i<queue->size;i++)
-    sum+=queue->data[i];
-  return sum;
+  return queue->sum;
 } /* of 'sumqueue' */
 
+Real convqueue(const Queue queue, /**< pointer to queue */
+               const Real coeff[] /**< coefficients, array of length queuesize() */
+              )                   /** \return sum of coeff[i]*queue[i] */
+{
+  const Real *data;
+  Real sum0,sum1,sum2,sum3;
+  int i;
+  /* queue elements are contiguous, use independent partial sums
+   * to allow vectorization by the compiler */
+  data=queue->data+queue->first;
+  sum0=sum1=sum2=sum3=0;
+  for(i=0;i+3<queue->size;i+=4)
+  {
+    sum0+=data[i]*coeff[i];
+    sum1+=data[i+1]*coeff[i+1];
+    sum2+=data[i+2]*coeff[i+2];
+    sum3+=data[i+3]*coeff[i+3];
+  }
+  for(;i<queue->size;i++)
+    sum0+=data[i]*coeff[i];
+  return (sum0+sum1)+(sum2+sum3);
+} /* of 'convqueue' */
+
 void freequeue(Queue queue /**< pointer to queue */
               )
 {
@@ -2,7 +2,8 @@
 /**                                                                                \n**/
 /**                      t  i  m  i  n  g  .  c                                    \n**/
 /**                                                                                \n**/
-/**     Declaration of global variable timing and timing_fcn                       \n**/
+/**     Declaration of global variable timing and timing_fcn and functions         \n**/
+/**     for the per-thread stack of open timing regions                            \n**/
 /**                                                                                \n**/
 /** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
 /** authors, and contributors see AUTHORS file                                     \n**/
@@ -22,16 +23,21 @@ double timing[N_FCN]={};
 
 char *timing_fcn[N_FCN]=
 {
+  "daily_agriculture",
+  "daily_grassland",
   "daily_littersom",
+  "daily_natural",
   "drain",
   "fopenoutput",
   "fwriterestart",
   "fwriteoutput",
   "gasdiffusion",
   "getclimate",
+  "infil_perc",
   "initinput",
   "initoutput",
   "irrig_amount_reservoir",
+  "landusechange",
   "MPI_Barrier",
   "MPI_Init",
   "newgrid",
@@ -41,6 +47,7 @@ char *timing_fcn[N_FCN]=
   "setupannual_grid",
   "storeclimate",
   "update_daily_cell",
+  "update_soil_thermal_state",
   "updatedaily_grid",
   "water_stressed",
   "wateruse",
@@ -48,4 +55,47 @@ char *timing_fcn[N_FCN]=
   "write_socket",
 };
 
+/* Time of region called inside another region, last row for regions not nested */
+
+double timing_nested[N_FCN+1][N_FCN]={};
+
+/* Stack of open regions, each thread has its own stack */
+
+static Timing_id timing_stack[TIMING_DEPTH];
+static int timing_depth=0;
+#ifdef USE_OPENMP
+#pragma omp threadprivate(timing_stack,timing_depth)
+#endif
+
+void timing_push(Timing_id id /**< region to be opened */
+                )
+{
+  if(timing_depth<TIMING_DEPTH)
+    timing_stack[timing_depth++]=id;
+} /* of 'timing_push' */
+
+void timing_pop(Timing_id id, /**< region to be closed */
+                double dt     /**< time spent in region (sec) */
+               )
+{
+  int i,parent;
+  /* close region and regions left open by an early return inside it */
+  for(i=timing_depth-1;i>=0;i--)
+    if(timing_stack[i]==id)
+    {
+      timing_depth=i;
+      break;
+    }
+  parent=(timing_depth>0) ? timing_stack[timing_depth-1] : NO_PARENT;
+  /* timing can be called concurrently from the threads of the cell loops */
+#ifdef USE_OPENMP
+#pragma omp atomic
+#endif
+  timing[id]+=dt;
+#ifdef USE_OPENMP
+#pragma omp atomic
+#endif
+  timing_nested[parent][id]+=dt;
+} /* of 'timing_pop' */
+
 #endif /* of USE_TIMING */
@@ -0,0 +1,339 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              w  r  i  t  e  q  u  e  u  e  .  c                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Implementation of asynchronous write queue for output files.               \n**/
+/**     Unscaled data are copied into a ring buffer. A separate writer             \n**/
+/**     thread applies scaling and offset and writes the data to raw,              \n**/
+/**     text or NetCDF files. Without pthread support data are written             \n**/
+/**     immediately.                                                               \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+#ifdef USE_PTHREAD
+#include <pthread.h>
+#endif
+
+typedef struct
+{
+  int fmt;           /**< file format (RAW/CLM/TXT/CDF) */
+  FILE *file;        /**< pointer to output file */
+  Netcdf *cdf;       /**< pointer to NetCDF file */
+  Type type;         /**< datatype of data (LPJ_SHORT/LPJ_FLOAT) */
+  int n;             /**< number of items in buffer */
+  Real scale;        /**< scaling factor applied before writing */
+  Real offset;       /**< offset added after scaling */
+  int index;         /**< time index in NetCDF file */
+  int layer;         /**< layer in NetCDF file or -1 for single layer */
+  char delimit;      /**< delimiter for text files */
+  Bool flush;        /**< flush file instead of writing data */
+  void *data;        /**< data buffer */
+  size_t size;       /**< size of data buffer in bytes */
+} Writejob;
+
+struct writequeue
+{
+  Writejob *jobs; /**< ring buffer of write jobs */
+  int size;       /**< size of ring buffer */
+  int first;      /**< index of first job in queue */
+  int n;          /**< number of jobs in queue */
+  int n_cdf;      /**< number of NetCDF jobs in queue */
+  Bool rc;        /**< error occurred in writer (TRUE/FALSE) */
+#ifdef USE_PTHREAD
+  Bool isfinish;  /**< writer thread has to terminate (TRUE/FALSE) */
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t notempty; /**< signalled if job has been added */
+  pthread_cond_t notfull;  /**< signalled if job has been finished */
+#endif
+}; /* definition of opaque datatype Writequeue */
+
+static Bool writejob(Writejob *job)
+{
+  int i;
+  if(job->flush)
+  {
+    if(job->fmt==CDF)
+      flush_netcdf(job->cdf);
+    else
+      fflush(job->file);
+    return FALSE;
+  }
+  if(job->scale!=1 || job->offset!=0)
+  {
+    if(job->type==LPJ_SHORT)
+      for(i=0;i<job->n;i++)
+        ((short *)job->data)[i]=(short)(job->scale*((short *)job->data)[i]+job->offset);
+    else
+      for(i=0;i<job->n;i++)
+        ((float *)job->data)[i]=(float)(job->scale*((float *)job->data)[i]+job->offset);
+  }
+  if(job->fmt==CDF)
+  {
+    if(job->layer<0)
+      return (job->type==LPJ_SHORT) ? write_short_netcdf(job->cdf,job->data,job->index,job->n)
+                                    : write_float_netcdf(job->cdf,job->data,job->index,job->n);
+    return (job->type==LPJ_SHORT) ? write_pft_short_netcdf(job->cdf,job->data,job->index,job->layer,job->n)
+                                  : write_pft_float_netcdf(job->cdf,job->data,job->index,job->layer,job->n);
+  }
+  if(job->fmt==TXT)
+  {
+    for(i=0;i<job->n;i++)
+      if(job->type==LPJ_SHORT)
+        fprintf(job->file,"%d%c",((short *)job->data)[i],(i==job->n-1) ? '\n' : job->delimit);
+      else
+        fprintf(job->file,"%g%c",((float *)job->data)[i],(i==job->n-1) ? '\n' : job->delimit);
+  }
+  else if(fwrite(job->data,typesizes[job->type],job->n,job->file)!=job->n)
+  {
+    fprintf(stderr,"ERROR204: Cannot write output: %s.\n",strerror(errno));
+    return TRUE;
+  }
+  return FALSE;
+} /* of 'writejob' */
+
+#ifdef USE_PTHREAD
+
+static void *writer(void *arg)
+{
+  Writequeue queue;
+  Bool rc;
+  queue=arg;
+  pthread_mutex_lock(&queue->mutex);
+  for(;;)
+  {
+    while(queue->n==0 && !queue->isfinish)
+      pthread_cond_wait(&queue->notempty,&queue->mutex);
+    if(queue->n==0)
+      break;
+    /* job stays in queue until written, so buffer is not reused */
+    pthread_mutex_unlock(&queue->mutex);
+    rc=writejob(queue->jobs+queue->first);
+    pthread_mutex_lock(&queue->mutex);
+    if(rc)
+      queue->rc=TRUE;
+    if(queue->jobs[queue->first].fmt==CDF)
+      queue->n_cdf--;
+    queue->first=(queue->first+1) % queue->size;
+    queue->n--;
+    pthread_cond_signal(&queue->notfull);
+  }
+  pthread_mutex_unlock(&queue->mutex);
+  return NULL;
+} /* of 'writer' */
+
+#endif
+
+Writequeue newwritequeue(int size /**< number of buffers in queue */
+                        )         /** \return pointer to queue or NULL on error */
+{
+  Writequeue queue;
+  int i;
+  if(size<1)
+    return NULL;
+  queue=new(struct writequeue);
+  if(queue==NULL)
+    return NULL;
+  queue->jobs=newvec(Writejob,size);
+  if(queue->jobs==NULL)
+  {
+    free(queue);
+    return NULL;
+  }
+  for(i=0;i<size;i++)
+  {
+    queue->jobs[i].data=NULL;
+    queue->jobs[i].size=0;
+  }
+  queue->size=size;
+  queue->first=queue->n=queue->n_cdf=0;
+  queue->rc=FALSE;
+#ifdef USE_PTHREAD
+  queue->isfinish=FALSE;
+  pthread_mutex_init(&queue->mutex,NULL);
+  pthread_cond_init(&queue->notempty,NULL);
+  pthread_cond_init(&queue->notfull,NULL);
+  if(pthread_create(&queue->thread,NULL,writer,queue))
+  {
+    pthread_mutex_destroy(&queue->mutex);
+    pthread_cond_destroy(&queue->notempty);
+    pthread_cond_destroy(&queue->notfull);
+    free(queue->jobs);
+    free(queue);
+    return NULL;
+  }
+#endif
+  return queue;
+} /* of 'newwritequeue' */
+
+static Bool putjob(Writequeue queue,const Writejob *job)
+{
+  Writejob *slot;
+  void *data;
+  size_t size;
+#ifdef USE_PTHREAD
+  Bool rc;
+  pthread_mutex_lock(&queue->mutex);
+  while(queue->n==queue->size)
+    pthread_cond_wait(&queue->notfull,&queue->mutex);
+  slot=queue->jobs+(queue->first+queue->n) % queue->size;
+  pthread_mutex_unlock(&queue->mutex);
+  /* slot is owned by the calling thread until it is added to the queue */
+#else
+  slot=queue->jobs;
+#endif
+  /* data are copied, because scaling is done in place by the writer */
+  size=typesizes[job->type]*job->n;
+  if(size>slot->size)
+  {
+    data=realloc(slot->data,size);
+    if(data==NULL)
+    {
+      printallocerr("data");
+      return TRUE;
+    }
+    slot->data=data;
+    slot->size=size;
+  }
+  if(size>0)
+    memcpy(slot->data,job->data,size);
+  data=slot->data;
+  size=slot->size;
+  *slot=*job;
+  slot->data=data;
+  slot->size=size;
+#ifdef USE_PTHREAD
+  pthread_mutex_lock(&queue->mutex);
+  queue->n++;
+  if(slot->fmt==CDF)
+    queue->n_cdf++;
+  rc=queue->rc;
+  pthread_cond_signal(&queue->notempty);
+  pthread_mutex_unlock(&queue->mutex);
+  return rc;
+#else
+  if(writejob(slot))
+    queue->rc=TRUE;
+  return queue->rc;
+#endif
+} /* of 'putjob' */
+
+Bool putwritequeue(Writequeue queue,  /**< pointer to queue */
+                   int fmt,           /**< file format (RAW/CLM/TXT/CDF) */
+                   FILE *file,        /**< pointer to output file or NULL */
+                   Netcdf *cdf,       /**< pointer to NetCDF file or NULL */
+                   Type type,         /**< datatype of data (LPJ_SHORT/LPJ_FLOAT) */
+                   const void *data,  /**< unscaled data to be written */
+                   int n,             /**< number of items */
+                   Real scale,        /**< scaling factor */
+                   Real offset,       /**< offset added after scaling */
+                   int index,         /**< time index for NetCDF files */
+                   int layer,         /**< layer for NetCDF files or -1 */
+                   char delimit       /**< delimiter for text files */
+                  )                   /** \return TRUE on error */
+{
+  Writejob job;
+  job.fmt=fmt;
+  job.file=file;
+  job.cdf=cdf;
+  job.type=type;
+  job.data=(void *)data;
+  job.n=n;
+  job.scale=scale;
+  job.offset=offset;
+  job.index=index;
+  job.layer=layer;
+  job.delimit=delimit;
+  job.flush=FALSE;
+  return putjob(queue,&job);
+} /* of 'putwritequeue' */
+
+Bool putflushqueue(Writequeue queue,  /**< pointer to queue */
+                   int fmt,           /**< file format (RAW/CLM/TXT/CDF) */
+                   FILE *file,        /**< pointer to output file or NULL */
+                   Netcdf *cdf        /**< pointer to NetCDF file or NULL */
+                  )                   /** \return TRUE on error */
+{
+  Writejob job;
+  job.fmt=fmt;
+  job.file=file;
+  job.cdf=cdf;
+  job.type=LPJ_BYTE;
+  job.data=NULL;
+  job.n=0;
+  job.scale=1;
+  job.offset=0;
+  job.index=job.layer=0;
+  job.delimit=' ';
+  job.flush=TRUE;
+  return putjob(queue,&job);
+} /* of 'putflushqueue' */
+
+Bool syncwritequeue(Writequeue queue /**< pointer to queue */
+                   )                 /** \return TRUE if error occurred in writer */
+{
+  Bool rc;
+#ifdef USE_PTHREAD
+  /* wait until all jobs have been written */
+  pthread_mutex_lock(&queue->mutex);
+  while(queue->n>0)
+    pthread_cond_wait(&queue->notfull,&queue->mutex);
+  rc=queue->rc;
+  pthread_mutex_unlock(&queue->mutex);
+#else
+  rc=queue->rc;
+#endif
+  return rc;
+} /* of 'syncwritequeue' */
+
+Bool syncnetcdfqueue(Writequeue queue /**< pointer to queue */
+                    )                 /** \return TRUE if error occurred in writer */
+{
+  Bool rc;
+#ifdef USE_PTHREAD
+  /* NetCDF library is not thread-safe, wait until no NetCDF job is pending
+     before NetCDF files are accessed by the calling thread */
+  pthread_mutex_lock(&queue->mutex);
+  while(queue->n_cdf>0)
+    pthread_cond_wait(&queue->notfull,&queue->mutex);
+  rc=queue->rc;
+  pthread_mutex_unlock(&queue->mutex);
+#else
+  rc=queue->rc;
+#endif
+  return rc;
+} /* of 'syncnetcdfqueue' */
+
+Bool freewritequeue(Writequeue queue /**< pointer to queue */
+                   )                 /** \return TRUE if error occurred in writer */
+{
+  int i;
+  Bool rc;
+  if(queue==NULL)
+    return FALSE;
+  rc=syncwritequeue(queue);
+#ifdef USE_PTHREAD
+  pthread_mutex_lock(&queue->mutex);
+  queue->isfinish=TRUE;
+  pthread_cond_signal(&queue->notempty);
+  pthread_mutex_unlock(&queue->mutex);
+  pthread_join(queue->thread,NULL);
+  pthread_mutex_destroy(&queue->mutex);
+  pthread_cond_destroy(&queue->notempty);
+  pthread_cond_destroy(&queue->notfull);
+#endif
+  for(i=0;i<queue->size;i++)
+    free(queue->jobs[i].data);
+  free(queue->jobs);
+  free(queue);
+  return rc;
+} /* of 'freewritequeue' */
@@ -14,21 +14,23 @@
 
 #include "lpj.h"
 
-#define USAGE "Usage: %s [-metafile] [-verbose] [-csv] [-short] file1.bin file2.bin\n"
+#define USAGE "Usage: %s [-metafile] [-verbose] [-csv] [-short] [-eps tol] file1.bin file2.bin\n"
 
 int main(int argc,char **argv)
 {
-  long n,nmax,count;
+  long n,nmax,count,ndiff;
   size_t offset;
   long long size1,size2;
   FILE *file1,*file2;
   float val1,val2;
-  double diff,max;
+  double diff,max,eps;
+  char *endptr;
   Header header1,header2;
   Bool ismeta,swap1,swap2,verbose,iscsv;
   int iarg;
   short sval1,sval2;
   ismeta=swap1=swap2=verbose=iscsv=FALSE;
+  eps=-1; /* no tolerance check */
   header1.datatype=LPJ_FLOAT;
   header2.datatype=LPJ_FLOAT;
   for(iarg=1;iarg<argc;iarg++)
@@ -42,6 +44,21 @@ int main(int argc,char **argv)
         iscsv=TRUE;
       else if(!strcmp(argv[iarg],"-short"))
         header1.datatype=header2.datatype=LPJ_SHORT;
+      else if(!strcmp(argv[iarg],"-eps"))
+      {
+        if(argc==iarg+1)
+        {
+          fprintf(stderr,"Missing argument after option '-eps'.\n"
+                  USAGE,argv[0]);
+          return EXIT_FAILURE;
+        }
+        eps=strtod(argv[++iarg],&endptr);
+        if(*endptr!='\0' || eps<0)
+        {
+          fprintf(stderr,"Invalid value '%s' for option '-eps'.\n",argv[iarg]);
+          return EXIT_FAILURE;
+        }
+      }
       else
       {
         fprintf(stderr,"Invalid option '%s'.\n",argv[iarg]);
@@ -202,6 +219,7 @@ int main(int argc,char **argv)
   max=0;
   nmax=0;
   diff=0;
+  ndiff=0;
   for(n=0;n<count;n++)
   {
     if(header1.datatype==LPJ_FLOAT)
@@ -234,6 +252,9 @@ int main(int argc,char **argv)
       printf("val1=%g, val2=%g, diff=%g\n",val1,val2,fabs(val1-val2));
     }
     diff+=fabs(val1-val2);
+    /* relative difference for large values, absolute difference for values below one */
+    if(eps>=0 && fabs(val1-val2)>eps*max(1,max(fabs(val1),fabs(val2))))
+      ndiff++;
   }
   fclose(file1);
   fclose(file2);
@@ -257,5 +278,10 @@ int main(int argc,char **argv)
     else
       printf((iscsv) ? "%g,%ld,%g,%g\n" : "max=%g at %ld, sum=%g,avg=%g\n",max,nmax,diff,diff/n);
   }
+  if(ndiff>0)
+  {
+    fprintf(stderr,"%ld of %ld values differ by more than %g.\n",ndiff,count,eps);
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 } /* of 'main' */
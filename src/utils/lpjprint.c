@@ -97,7 +97,7 @@ static Bool printgrid(Config *config, /* Pointer to LPJ configuration */
   }
   /* If FROM_RESTART open restart file */
   config->count=0;
-  file_restart=openrestart((config->ischeckpoint) ? config->checkpoint_restart_filename : config->write_restart_filename,config,npft,ncft);
+  file_restart=openrestart((config->ischeckpoint) ? config->checkpoint_restart_filename : config->write_restart_filename,config,npft,ncft,FALSE);
   if(file_restart==NULL)
     return TRUE;
 
@@ -0,0 +1,159 @@
+/**************************************************************************************/
+/**                                                                                \n**/
+/**              q  u  e  u  e  b  e  n  c  h  .  c                                \n**/
+/**                                                                                \n**/
+/**     C implementation of LPJmL                                                  \n**/
+/**                                                                                \n**/
+/**     Micro-benchmark for convolution of discharge queues                        \n**/
+/**                                                                                \n**/
+/** (C) Potsdam Institute for Climate Impact Research (PIK), see COPYRIGHT file    \n**/
+/** authors, and contributors see AUTHORS file                                     \n**/
+/** This file is part of LPJmL and licensed under GNU AGPL Version 3               \n**/
+/** or later. See LICENSE file or go to http://www.gnu.org/licenses/               \n**/
+/** Contact: https://github.com/PIK-LPJmL/LPJmL                                    \n**/
+/**                                                                                \n**/
+/**************************************************************************************/
+
+#include "lpj.h"
+
+#define USAGE "Usage: %s [-ncell n] [-nstep n]\n"
+#define NCELL 1000       /* default number of river cells */
+#define NSTEP 10000      /* default number of time steps */
+#define RLENGTH_MIN 5e3  /* minimum river length (m) */
+#define RLENGTH_MAX 3e5  /* maximum river length (m) */
+
+typedef struct
+{
+  Real *data;
+  int size;
+  int first;
+} Ring; /* reference implementation of queue using modulo indexing */
+
+int main(int argc,char **argv)
+{
+  Queue *queue;
+  Ring *ring;
+  Real **tfunct;
+  Real val,fout,fout_ref,sum,sum_ref,maxdiff;
+  double tstart,t_ref,t_queue;
+  int i,j,t,iarg,ncell,nstep,size,maxsize;
+  char *endptr;
+  ncell=NCELL;
+  nstep=NSTEP;
+  for(iarg=1;iarg<argc;iarg++)
+    if(argv[iarg][0]=='-')
+    {
+      if(!strcmp(argv[iarg],"-ncell") || !strcmp(argv[iarg],"-nstep"))
+      {
+        if(iarg==argc-1)
+        {
+          fprintf(stderr,"Argument missing after '%s' option.\n"
+                  USAGE,argv[iarg],argv[0]);
+          return EXIT_FAILURE;
+        }
+        i=strtol(argv[iarg+1],&endptr,10);
+        if(*endptr!='\0' || i<1)
+        {
+          fprintf(stderr,"Invalid number '%s' for option '%s'.\n",
+                  argv[iarg+1],argv[iarg]);
+          return EXIT_FAILURE;
+        }
+        if(!strcmp(argv[iarg],"-ncell"))
+          ncell=i;
+        else
+          nstep=i;
+        iarg++;
+      }
+      else
+      {
+        fprintf(stderr,"Invalid option '%s'.\n"
+                USAGE,argv[iarg],argv[0]);
+        return EXIT_FAILURE;
+      }
+    }
+    else
+    {
+      fprintf(stderr,"Invalid argument '%s'.\n"
+              USAGE,argv[iarg],argv[0]);
+      return EXIT_FAILURE;
+    }
+  queue=newvec(Queue,ncell);
+  check(queue);
+  ring=newvec(Ring,ncell);
+  check(ring);
+  tfunct=newvec(Real *,ncell);
+  check(tfunct);
+  maxsize=0;
+  /* river lengths uniformly distributed between RLENGTH_MIN and RLENGTH_MAX */
+  for(i=0;i<ncell;i++)
+  {
+    tfunct[i]=transfer_function(RLENGTH_MIN+(RLENGTH_MAX-RLENGTH_MIN)*i/ncell,&size);
+    if(tfunct[i]==NULL)
+      return EXIT_FAILURE;
+    if(size>maxsize)
+      maxsize=size;
+    queue[i]=newqueue(size);
+    check(queue[i]);
+    ring[i].data=newvec(Real,size);
+    check(ring[i].data);
+    for(j=0;j<size;j++)
+      ring[i].data[j]=0;
+    ring[i].size=size;
+    ring[i].first=size-1;
+  }
+  printf("Number of cells:\t%d\n"
+         "Number of steps:\t%d\n"
+         "Max. queue size:\t%d\n",ncell,nstep,maxsize);
+  /* reference: modulo indexing and summation over all elements */
+  srand(1);
+  fout_ref=sum_ref=0;
+  tstart=mrun();
+  for(t=0;t<nstep;t++)
+    for(i=0;i<ncell;i++)
+    {
+      for(j=0;j<ring[i].size;j++)
+        fout_ref+=ring[i].data[(ring[i].first+j) % ring[i].size]*tfunct[i][j];
+      val=(Real)rand()/RAND_MAX;
+      ring[i].first=(ring[i].first-1+ring[i].size) % ring[i].size;
+      ring[i].data[ring[i].first]=val;
+      for(j=0;j<ring[i].size;j++)
+        sum_ref+=ring[i].data[j];
+    }
+  t_ref=mrun()-tstart;
+  /* mirrored queue with running sum */
+  srand(1);
+  fout=sum=0;
+  tstart=mrun();
+  for(t=0;t<nstep;t++)
+    for(i=0;i<ncell;i++)
+    {
+      fout+=convqueue(queue[i],tfunct[i]);
+      val=(Real)rand()/RAND_MAX;
+      putqueue(queue[i],val);
+      sum+=sumqueue(queue[i]);
+    }
+  t_queue=mrun()-tstart;
+  maxdiff=0;
+  for(i=0;i<ncell;i++)
+    for(j=0;j<ring[i].size;j++)
+      maxdiff=max(maxdiff,fabs(getqueue(queue[i],j)-ring[i].data[(ring[i].first+j) % ring[i].size]));
+  printf("Reference (s):\t\t%g\n"
+         "Queue (s):\t\t%g\n"
+         "Speedup:\t\t%g\n"
+         "Rel. diff. outflow:\t%g\n"
+         "Rel. diff. sum:\t\t%g\n"
+         "Max. diff. queue:\t%g\n",
+         t_ref,t_queue,(t_queue>0) ? t_ref/t_queue : 0,
+         fabs(fout-fout_ref)/max(fabs(fout_ref),epsilon),
+         fabs(sum-sum_ref)/max(fabs(sum_ref),epsilon),maxdiff);
+  for(i=0;i<ncell;i++)
+  {
+    freequeue(queue[i]);
+    free(ring[i].data);
+    free(tfunct[i]);
+  }
+  free(queue);
+  free(ring);
+  free(tfunct);
+  return EXIT_SUCCESS;
+} /* of 'main' */